@@ -49,6 +49,9 @@ struct distortos_Semaphore
 
 	/** max value of the semaphore */
 	unsigned int maxValue;
+
+	/** pointer to QueueSet which is notified when the value of the semaphore is incremented, NULL if none */
+	void* queueSet;
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -67,7 +70,8 @@ struct distortos_Semaphore
  */
 
 #define DISTORTOS_SEMAPHORE_INITIALIZER(self, value, maxValue) \
-		{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), (value) < (maxValue) ? (value) : (maxValue), (maxValue)}
+		{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), (value) < (maxValue) ? (value) : (maxValue), (maxValue), \
+		NULL}
 
 /**
  * \brief C-API equivalent of distortos::Semaphore's constructor
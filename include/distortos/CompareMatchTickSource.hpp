@@ -0,0 +1,151 @@
+/**
+ * \file
+ * \brief CompareMatchTickSource class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_COMPAREMATCHTICKSOURCE_HPP_
+#define INCLUDE_DISTORTOS_COMPAREMATCHTICKSOURCE_HPP_
+
+#include "distortos/TickSource.hpp"
+
+#include <cstdint>
+
+namespace distortos
+{
+
+/**
+ * \brief CompareMatchTickSource class is a base for tick sources which use free-running hardware counter with compare
+ * register.
+ *
+ * The counter is never reloaded - each tick is generated by one-shot compare-match, and compare register is then
+ * advanced by one tick period. When frequency of the counter is not an integer multiple of DISTORTOS_TICK_FREQUENCY
+ * (e.g. 32768 Hz low-power timer with 1000 Hz tick), tick periods are alternated between two lengths, so that there is
+ * no cumulative drift. Counters narrower than 32 bits (e.g. 16-bit low-power timers) are supported, as long as tick
+ * period is shorter than half of counter's range.
+ *
+ * Derived class implements access to particular hardware timer and calls interruptHandler() from its compare-match
+ * interrupt handler.
+ *
+ * \ingroup clocks
+ */
+
+class CompareMatchTickSource : public TickSource
+{
+public:
+
+	/**
+	 * \brief CompareMatchTickSource's constructor
+	 *
+	 * \param [in] counterFrequency is the frequency of counter, Hz
+	 * \param [in] counterMask is the mask of valid bits of counter, e.g. 0xffff for 16-bit counter
+	 */
+
+	constexpr CompareMatchTickSource(const uint32_t counterFrequency, const uint32_t counterMask) :
+			counterFrequency_{counterFrequency},
+			counterMask_{counterMask},
+			error_{},
+			lastTick_{},
+			period_{}
+	{
+
+	}
+
+	/**
+	 * \brief Gets time which passed since last tick.
+	 *
+	 * Time is measured from the nominal instant of last tick, which includes the accumulated fractional part of tick
+	 * period. As the tick is handled at integer value of counter, it may be handled up to one counter's cycle before
+	 * its nominal instant - until that instant is reached, returned value is zero.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 *
+	 * \return time which passed since nominal instant of last tick which was handled with handleTick()
+	 */
+
+	std::chrono::nanoseconds getTimeSinceTick() const override;
+
+	/**
+	 * \brief Interrupt handler of compare-match.
+	 *
+	 * Handles all ticks which passed since last call and programs compare register for the next tick.
+	 *
+	 * \attention This function must be called from compare-match interrupt handler of derived class, after the
+	 * interrupt flag is cleared.
+	 */
+
+	void interruptHandler();
+
+	/**
+	 * \brief Starts generation of ticks with DISTORTOS_TICK_FREQUENCY.
+	 *
+	 * Programs compare register for the first tick and starts the counter.
+	 */
+
+	void start() override;
+
+protected:
+
+	/**
+	 * \return current value of counter
+	 */
+
+	virtual uint32_t getCounter() const = 0;
+
+	/**
+	 * \brief Sets compare register.
+	 *
+	 * \param [in] compare is the new value of compare register
+	 */
+
+	virtual void setCompare(uint32_t compare) = 0;
+
+	/**
+	 * \brief Starts the counter and enables compare-match interrupt.
+	 *
+	 * \note Before this function is called getCounter() must return stable value and setCompare() must be usable.
+	 */
+
+	virtual void startCounter() = 0;
+
+private:
+
+	/**
+	 * \return number of counter's cycles which passed since last tick
+	 */
+
+	uint32_t getElapsedCycles() const
+	{
+		return (getCounter() - lastTick_) & counterMask_;
+	}
+
+	/**
+	 * \brief Updates period of next tick.
+	 */
+
+	void updatePeriod();
+
+	/// frequency of counter, Hz
+	uint32_t counterFrequency_;
+
+	/// mask of valid bits of counter
+	uint32_t counterMask_;
+
+	/// accumulated fractional part of tick period, in 1 / DISTORTOS_TICK_FREQUENCY units of counter's cycle
+	uint32_t error_;
+
+	/// value of counter at last tick
+	uint32_t lastTick_;
+
+	/// period of next tick, counter's cycles
+	uint32_t period_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_COMPAREMATCHTICKSOURCE_HPP_
@@ -43,6 +43,8 @@ namespace distortos
 template<typename T>
 class FifoQueue
 {
+	friend class QueueSet;
+
 public:
 
 	/// type of uninitialized storage for data
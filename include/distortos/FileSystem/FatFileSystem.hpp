@@ -58,15 +58,18 @@ public:
 	 * \param [in] blockSize is the block size, bytes, 0 to use default value of device, default - 0
 	 * \param [in] blocksCount is the number of blocks used when formating the device with the file system, 0 to use max
 	 * value of device, default - 0
+	 * \param [in] maxBitmapSize is the max size of free-cluster bitmap, bytes, 0 to disable the bitmap, default - 0
 	 */
 
 	constexpr explicit FatFileSystem(devices::BlockDevice& blockDevice, const size_t blockSize = {},
-			const size_t blocksCount = {}) :
+			const size_t blocksCount = {}, const size_t maxBitmapSize = {}) :
 				device_{{}, blockDevice},
 				fileSystem_{},
 				mutex_{Mutex::Type::recursive, Mutex::Protocol::priorityInheritance},
+				bitmap_{},
 				blocksCount_{blocksCount},
 				blockSize_{blockSize},
+				maxBitmapSize_{maxBitmapSize},
 				mounted_{}
 	{
 
@@ -185,6 +188,12 @@ public:
 	/**
 	 * \brief Mounts file system on associated device.
 	 *
+	 * If the free-cluster bitmap for the whole file system (one bit per cluster) fits in the max size passed to
+	 * constructor, it is allocated here. It is built with a single scan of the FAT when free clusters are searched for
+	 * or counted for the first time, later it is kept up-to-date, so the FAT doesn't have to be read to find free
+	 * clusters. Calling getStatus() right after mounting moves this scan out of the first write. If the bitmap doesn't
+	 * fit or cannot be allocated, free clusters are found by reading the FAT.
+	 *
 	 * \warning This function must not be called from interrupt context!
 	 *
 	 * \pre %File system is unmounted.
@@ -327,12 +336,18 @@ private:
 	/// mutex for serializing access to the object
 	distortos::Mutex mutex_;
 
+	/// free-cluster bitmap, nullptr if not used
+	std::unique_ptr<uint32_t[]> bitmap_;
+
 	/// number of blocks used when formating the device with the file system, 0 to use max value of device
 	size_t blocksCount_;
 
 	/// block size, bytes, 0 to use default value of device
 	size_t blockSize_;
 
+	/// max size of free-cluster bitmap, bytes, 0 to disable the bitmap
+	size_t maxBitmapSize_;
+
 	/// tells whether the file system is currently mounted on associated block device (true) or not (false)
 	bool mounted_;
 };
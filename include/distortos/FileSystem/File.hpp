@@ -50,6 +50,28 @@ public:
 
 	virtual ~File() = default;
 
+	/**
+	 * \brief Allocates space for file.
+	 *
+	 * Similar to [posix_fallocate()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/posix_fallocate.html)
+	 *
+	 * If the size of the file is less than \a offset + \a length, the file is extended to this size and the added part
+	 * is filled with zeros. Current file offset is not changed.
+	 *
+	 * \pre %File is opened.
+	 *
+	 * \param [in] offset is the offset of the beginning of the range, bytes
+	 * \param [in] length is the length of the range, bytes
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - file is not opened for writing;
+	 * - EFBIG - \a offset + \a length is greater than max size of file;
+	 * - EINVAL - \a offset is less than 0 or \a length is not greater than 0;
+	 * - ENOSPC - no space left on the device containing the file;
+	 */
+
+	virtual int allocate(off_t offset, off_t length) = 0;
+
 	/**
 	 * \brief Closes file.
 	 *
@@ -149,6 +171,30 @@ public:
 
 	virtual std::pair<int, size_t> read(void* buffer, size_t size) = 0;
 
+	/**
+	 * \brief Reads data from file at given position.
+	 *
+	 * Similar to [pread()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/pread.html)
+	 *
+	 * Current file offset is not changed. Default implementation locks the file, moves file offset to \a position,
+	 * reads the data with read() and restores previous file offset, so no other thread can observe intermediate file
+	 * offset.
+	 *
+	 * \pre \a buffer is valid.
+	 *
+	 * \param [in] position is the position in file from which the data will be read, bytes
+	 * \param [out] buffer is the buffer into which the data will be read, must be valid
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by getPosition();
+	 * - error codes returned by read();
+	 * - error codes returned by seek();
+	 */
+
+	virtual std::pair<int, size_t> readAt(off_t position, void* buffer, size_t size);
+
 	/**
 	 * \brief Resets current file offset.
 	 *
@@ -221,6 +267,33 @@ public:
 
 	virtual std::pair<int, size_t> write(const void* buffer, size_t size) = 0;
 
+	/**
+	 * \brief Writes data to file at given position.
+	 *
+	 * Similar to [pwrite()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/pwrite.html)
+	 *
+	 * Current file offset is not changed. Default implementation locks the file, moves file offset to \a position,
+	 * writes the data with write() and restores previous file offset, so no other thread can observe intermediate file
+	 * offset.
+	 *
+	 * \note If the file was opened with `O_APPEND`, the data is appended to the end of file, regardless of
+	 * \a position.
+	 *
+	 * \pre \a buffer is valid.
+	 *
+	 * \param [in] position is the position in file at which the data will be written, bytes
+	 * \param [in] buffer is the buffer with data that will be written, must be valid
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of written bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by getPosition();
+	 * - error codes returned by seek();
+	 * - error codes returned by write();
+	 */
+
+	virtual std::pair<int, size_t> writeAt(off_t position, const void* buffer, size_t size);
+
 	File() = default;
 	File(const File&) = delete;
 	File& operator=(const File&) = delete;
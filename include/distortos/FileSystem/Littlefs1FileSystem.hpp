@@ -2,7 +2,7 @@
  * \file
  * \brief Littlefs1FileSystem class header
  *
- * \author Copyright (C) 2018-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,10 @@
 
 #include "lfs1.h"
 
+#include <type_traits>
+
+#include <cstddef>
+
 namespace distortos
 {
 
@@ -41,6 +45,35 @@ class Littlefs1FileSystem : public FileSystem
 
 public:
 
+	/// storage for object of opened file, element of pool of opened files; its size includes pointer to owner file
+	/// system placed before the object and padding, sufficiency of this size is checked by Littlefs1File
+	using FileStorage = std::aligned_storage<2 * alignof(std::max_align_t) + sizeof(lfs1_file_t) +
+			sizeof(lfs1_file_config) + 2 * sizeof(void*), alignof(std::max_align_t)>::type;
+
+	/// buffers used by littlefs-v1 instead of dynamically allocated ones, any of them may be nullptr
+	struct Buffers
+	{
+		/// read cache, readBlockSize bytes
+		void* readBuffer;
+
+		/// program cache, programBlockSize bytes
+		void* programBuffer;
+
+		/// lookahead buffer, lookahead / 8 bytes, aligned to 32-bit boundary
+		void* lookaheadBuffer;
+
+		/// pool of caches of opened files, fileBuffersCount * programBlockSize bytes
+		void* fileBuffers;
+
+		/// pool of storage for objects of opened files, fileBuffersCount elements, nullptr to allocate these objects
+		/// dynamically
+		FileStorage* fileStorages;
+
+		/// number of elements in pools of caches and storage for objects of opened files, which is also the max number
+		/// of concurrently opened files, [0; 32]
+		size_t fileBuffersCount;
+	};
+
 	/**
 	 * \brief Littlefs1FileSystem's constructor
 	 *
@@ -57,16 +90,8 @@ public:
 	constexpr explicit Littlefs1FileSystem(devices::MemoryTechnologyDevice& memoryTechnologyDevice,
 			const size_t readBlockSize = {}, const size_t programBlockSize = {}, const size_t eraseBlockSize = {},
 			const size_t blocksCount = {}, const size_t lookahead = 32 * 16) :
-					configuration_{},
-					fileSystem_{},
-					mutex_{Mutex::Type::recursive, Mutex::Protocol::priorityInheritance},
-					memoryTechnologyDevice_{memoryTechnologyDevice},
-					readBlockSize_{readBlockSize},
-					programBlockSize_{programBlockSize},
-					eraseBlockSize_{eraseBlockSize},
-					blocksCount_{blocksCount},
-					lookahead_{lookahead},
-					mounted_{}
+					Littlefs1FileSystem{Buffers{}, memoryTechnologyDevice, readBlockSize, programBlockSize,
+							eraseBlockSize, blocksCount, lookahead}
 	{
 
 	}
@@ -77,6 +102,7 @@ public:
 	 * \warning This function must not be called from interrupt context!
 	 *
 	 * \pre %File system is unmounted.
+	 * \pre All files opened from the file system are destroyed.
 	 */
 
 	~Littlefs1FileSystem() override;
@@ -224,6 +250,7 @@ public:
 	 *
 	 * \return pair with return code (0 on success, error code otherwise) and `std::unique_ptr` with opened file; error
 	 * codes:
+	 * - EMFILE - all elements of pool of opened files are in use;
 	 * - ENOMEM - unable to allocate memory for file;
 	 * - error codes returned by Littlefs1File::open();
 	 */
@@ -297,8 +324,87 @@ public:
 
 	int unmount() override;
 
+protected:
+
+	/**
+	 * \brief Littlefs1FileSystem's constructor
+	 *
+	 * \param [in] buffers are the buffers used by littlefs-v1 instead of dynamically allocated ones, sizes of provided
+	 * buffers must match \a readBlockSize, \a programBlockSize and \a lookahead
+	 * \param [in] memoryTechnologyDevice is a reference to memory technology device on which the file system will be
+	 * mounted
+	 * \param [in] readBlockSize is the read block size, bytes, 0 to use default value of device
+	 * \param [in] programBlockSize is the program block size, bytes, 0 to use default value of device
+	 * \param [in] eraseBlockSize is the erase block size, bytes, 0 to use default value of device
+	 * \param [in] blocksCount is the number of erase blocks used for file system, 0 to use max value of device
+	 * \param [in] lookahead is the number of blocks to lookahead during block allocation
+	 */
+
+	constexpr Littlefs1FileSystem(const Buffers& buffers, devices::MemoryTechnologyDevice& memoryTechnologyDevice,
+			const size_t readBlockSize, const size_t programBlockSize, const size_t eraseBlockSize,
+			const size_t blocksCount, const size_t lookahead) :
+					configuration_{},
+					fileSystem_{},
+					mutex_{Mutex::Type::recursive, Mutex::Protocol::priorityInheritance},
+					buffers_(buffers),
+					memoryTechnologyDevice_{memoryTechnologyDevice},
+					readBlockSize_{readBlockSize},
+					programBlockSize_{programBlockSize},
+					eraseBlockSize_{eraseBlockSize},
+					blocksCount_{blocksCount},
+					lookahead_{lookahead},
+					usedFileBuffers_{},
+					usedFileStorages_{},
+					mounted_{}
+	{
+
+	}
+
 private:
 
+	/**
+	 * \brief Takes a cache of opened file from the pool.
+	 *
+	 * \pre %File system is locked.
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to cache of opened file, nullptr
+	 * if the pool is not used and littlefs-v1 should allocate the cache by itself; error codes:
+	 * - EMFILE - all caches from the pool are in use;
+	 */
+
+	std::pair<int, void*> allocateFileBuffer();
+
+	/**
+	 * \brief Returns a cache of opened file to the pool.
+	 *
+	 * \pre %File system is locked.
+	 *
+	 * \param [in] fileBuffer is a pointer to cache of opened file returned by allocateFileBuffer(), nullptr is ignored
+	 */
+
+	void deallocateFileBuffer(const void* fileBuffer);
+
+	/**
+	 * \brief Takes a storage for object of opened file from the pool.
+	 *
+	 * \pre %File system is locked.
+	 * \pre Pool of storage for objects of opened files is used.
+	 *
+	 * \return pointer to storage for object of opened file, nullptr if all elements of the pool are in use
+	 */
+
+	FileStorage* allocateFileStorage();
+
+	/**
+	 * \brief Returns a storage for object of opened file to the pool.
+	 *
+	 * \pre %File system is locked.
+	 *
+	 * \param [in] fileStorage is a pointer to storage for object of opened file returned by allocateFileStorage()
+	 */
+
+	void deallocateFileStorage(const FileStorage* fileStorage);
+
 	/// configuration of littlefs-v1
 	lfs1_config configuration_;
 
@@ -308,6 +414,9 @@ private:
 	/// mutex for serializing access to the object
 	distortos::Mutex mutex_;
 
+	/// buffers used by littlefs-v1 instead of dynamically allocated ones
+	Buffers buffers_;
+
 	/// reference to associated memory technology device
 	devices::MemoryTechnologyDevice& memoryTechnologyDevice_;
 
@@ -326,6 +435,12 @@ private:
 	/// number of blocks to lookahead during block allocation
 	size_t lookahead_;
 
+	/// bitmask with caches from the pool which are currently used by opened files
+	uint32_t usedFileBuffers_;
+
+	/// bitmask with elements of pool of storage for objects of opened files which are currently used
+	uint32_t usedFileStorages_;
+
 	/// tells whether the file system is currently mounted on associated memory technology device (true) or not (false)
 	bool mounted_;
 };
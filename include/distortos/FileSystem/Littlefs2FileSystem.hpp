@@ -2,7 +2,7 @@
  * \file
  * \brief Littlefs2FileSystem class header
  *
- * \author Copyright (C) 2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2019-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,10 @@
 
 #include "lfs2.h"
 
+#include <type_traits>
+
+#include <cstddef>
+
 namespace distortos
 {
 
@@ -41,6 +45,35 @@ class Littlefs2FileSystem : public FileSystem
 
 public:
 
+	/// storage for object of opened file, element of pool of opened files; its size includes pointer to owner file
+	/// system placed before the object and padding, sufficiency of this size is checked by Littlefs2File
+	using FileStorage = std::aligned_storage<2 * alignof(std::max_align_t) + sizeof(lfs2_file_t) +
+			sizeof(lfs2_file_config) + 2 * sizeof(void*), alignof(std::max_align_t)>::type;
+
+	/// buffers used by littlefs-v2 instead of dynamically allocated ones, any of them may be nullptr
+	struct Buffers
+	{
+		/// read cache, cacheSize bytes
+		void* readBuffer;
+
+		/// program cache, cacheSize bytes
+		void* programBuffer;
+
+		/// lookahead buffer, lookaheadSize bytes, aligned to 32-bit boundary
+		void* lookaheadBuffer;
+
+		/// pool of caches of opened files, fileBuffersCount * cacheSize bytes
+		void* fileBuffers;
+
+		/// pool of storage for objects of opened files, fileBuffersCount elements, nullptr to allocate these objects
+		/// dynamically
+		FileStorage* fileStorages;
+
+		/// number of elements in pools of caches and storage for objects of opened files, which is also the max number
+		/// of concurrently opened files, [0; 32]
+		size_t fileBuffersCount;
+	};
+
 	/**
 	 * \brief Littlefs2FileSystem's constructor
 	 *
@@ -72,21 +105,9 @@ public:
 			const size_t blocksCount = {}, const int32_t blockCycles = 1000, const size_t cacheSize = {},
 			const size_t lookaheadSize = 64 * 8, const size_t filenameLengthLimit = {}, const size_t fileSizeLimit = {},
 			const size_t attributeSizeLimit = {}) :
-					configuration_{},
-					fileSystem_{},
-					mutex_{Mutex::Type::recursive, Mutex::Protocol::priorityInheritance},
-					memoryTechnologyDevice_{memoryTechnologyDevice},
-					readBlockSize_{readBlockSize},
-					programBlockSize_{programBlockSize},
-					eraseBlockSize_{eraseBlockSize},
-					blocksCount_{blocksCount},
-					blockCycles_{blockCycles},
-					cacheSize_{cacheSize},
-					lookaheadSize_{lookaheadSize},
-					filenameLengthLimit_{filenameLengthLimit},
-					fileSizeLimit_{fileSizeLimit},
-					attributeSizeLimit_{attributeSizeLimit},
-					mounted_{}
+					Littlefs2FileSystem{Buffers{}, memoryTechnologyDevice, readBlockSize, programBlockSize,
+							eraseBlockSize, blocksCount, blockCycles, cacheSize, lookaheadSize, filenameLengthLimit,
+							fileSizeLimit, attributeSizeLimit}
 	{
 
 	}
@@ -97,6 +118,7 @@ public:
 	 * \warning This function must not be called from interrupt context!
 	 *
 	 * \pre %File system is unmounted.
+	 * \pre All files opened from the file system are destroyed.
 	 */
 
 	~Littlefs2FileSystem() override;
@@ -244,6 +266,7 @@ public:
 	 *
 	 * \return pair with return code (0 on success, error code otherwise) and `std::unique_ptr` with opened file; error
 	 * codes:
+	 * - EMFILE - all elements of pool of opened files are in use;
 	 * - ENOMEM - unable to allocate memory for file;
 	 * - error codes returned by Littlefs2File::open();
 	 */
@@ -317,8 +340,105 @@ public:
 
 	int unmount() override;
 
+protected:
+
+	/**
+	 * \brief Littlefs2FileSystem's constructor
+	 *
+	 * \param [in] buffers are the buffers used by littlefs-v2 instead of dynamically allocated ones, sizes of provided
+	 * buffers must match \a cacheSize and \a lookaheadSize
+	 * \param [in] memoryTechnologyDevice is a reference to memory technology device on which the file system will be
+	 * mounted
+	 * \param [in] readBlockSize is the read block size, bytes, 0 to use default value of device
+	 * \param [in] programBlockSize is the program block size, bytes, 0 to use default value of device
+	 * \param [in] eraseBlockSize is the erase block size, bytes, must be a multiple of read/program block size, 0 to
+	 * use default value of device
+	 * \param [in] blocksCount is the number of erase blocks used for file system, 0 to use max value of device
+	 * \param [in] blockCycles is the number of erase cycles before file system moves metadata to another block, larger
+	 * values give better performance but less consistent wear distribution, recommended [100; 1000], -1 to disable
+	 * wear-leveling
+	 * \param [in] cacheSize is the block cache size, bytes, must be a multiple of read/program block size and a factor
+	 * of erase block size, 0 to use larger of read/program block size
+	 * \param [in] lookaheadSize is the number of blocks to lookahead during block allocation, must be a multiple of 64
+	 * \param [in] filenameLengthLimit is the limit of filename length, bytes, this value is stored in superblock, 0 to
+	 * use LFS2_NAME_MAX
+	 * \param [in] fileSizeLimit is the limit of file size, bytes, this value is stored in superblock, 0 to use
+	 * LFS2_FILE_MAX
+	 * \param [in] attributeSizeLimit is the limit of custom attribute size, bytes, this value is stored in superblock,
+	 * 0 to use LFS2_ATTR_MAX
+	 */
+
+	constexpr Littlefs2FileSystem(const Buffers& buffers, devices::MemoryTechnologyDevice& memoryTechnologyDevice,
+			const size_t readBlockSize, const size_t programBlockSize, const size_t eraseBlockSize,
+			const size_t blocksCount, const int32_t blockCycles, const size_t cacheSize, const size_t lookaheadSize,
+			const size_t filenameLengthLimit, const size_t fileSizeLimit, const size_t attributeSizeLimit) :
+					configuration_{},
+					fileSystem_{},
+					mutex_{Mutex::Type::recursive, Mutex::Protocol::priorityInheritance},
+					buffers_(buffers),
+					memoryTechnologyDevice_{memoryTechnologyDevice},
+					readBlockSize_{readBlockSize},
+					programBlockSize_{programBlockSize},
+					eraseBlockSize_{eraseBlockSize},
+					blocksCount_{blocksCount},
+					blockCycles_{blockCycles},
+					cacheSize_{cacheSize},
+					lookaheadSize_{lookaheadSize},
+					filenameLengthLimit_{filenameLengthLimit},
+					fileSizeLimit_{fileSizeLimit},
+					attributeSizeLimit_{attributeSizeLimit},
+					usedFileBuffers_{},
+					usedFileStorages_{},
+					mounted_{}
+	{
+
+	}
+
 private:
 
+	/**
+	 * \brief Takes a cache of opened file from the pool.
+	 *
+	 * \pre %File system is locked.
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to cache of opened file, nullptr
+	 * if the pool is not used and littlefs-v2 should allocate the cache by itself; error codes:
+	 * - EMFILE - all caches from the pool are in use;
+	 */
+
+	std::pair<int, void*> allocateFileBuffer();
+
+	/**
+	 * \brief Returns a cache of opened file to the pool.
+	 *
+	 * \pre %File system is locked.
+	 *
+	 * \param [in] fileBuffer is a pointer to cache of opened file returned by allocateFileBuffer(), nullptr is ignored
+	 */
+
+	void deallocateFileBuffer(const void* fileBuffer);
+
+	/**
+	 * \brief Takes a storage for object of opened file from the pool.
+	 *
+	 * \pre %File system is locked.
+	 * \pre Pool of storage for objects of opened files is used.
+	 *
+	 * \return pointer to storage for object of opened file, nullptr if all elements of the pool are in use
+	 */
+
+	FileStorage* allocateFileStorage();
+
+	/**
+	 * \brief Returns a storage for object of opened file to the pool.
+	 *
+	 * \pre %File system is locked.
+	 *
+	 * \param [in] fileStorage is a pointer to storage for object of opened file returned by allocateFileStorage()
+	 */
+
+	void deallocateFileStorage(const FileStorage* fileStorage);
+
 	/// configuration of littlefs-v2
 	lfs2_config configuration_;
 
@@ -328,6 +448,9 @@ private:
 	/// mutex for serializing access to the object
 	distortos::Mutex mutex_;
 
+	/// buffers used by littlefs-v2 instead of dynamically allocated ones
+	Buffers buffers_;
+
 	/// reference to associated memory technology device
 	devices::MemoryTechnologyDevice& memoryTechnologyDevice_;
 
@@ -363,6 +486,12 @@ private:
 	/// limit of custom attribute size, bytes, this value is stored in superblock, 0 to use LFS2_ATTR_MAX
 	size_t attributeSizeLimit_;
 
+	/// bitmask with caches from the pool which are currently used by opened files
+	uint32_t usedFileBuffers_;
+
+	/// bitmask with elements of pool of storage for objects of opened files which are currently used
+	uint32_t usedFileStorages_;
+
 	/// tells whether the file system is currently mounted on associated memory technology device (true) or not (false)
 	bool mounted_;
 };
@@ -0,0 +1,89 @@
+/**
+ * \file
+ * \brief StaticLittlefs1FileSystem class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_FILESYSTEM_STATICLITTLEFS1FILESYSTEM_HPP_
+#define INCLUDE_DISTORTOS_FILESYSTEM_STATICLITTLEFS1FILESYSTEM_HPP_
+
+#include "distortos/FileSystem/Littlefs1FileSystem.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticLittlefs1FileSystem class is a variant of Littlefs1FileSystem that has automatic storage for all caches
+ * and opened files.
+ *
+ * Neither mounting of file system nor opening of files uses dynamic memory. Objects of opened files and their caches
+ * are taken from fixed pools, so at most \a MaxOpenFiles files may exist at the same time - storage of opened file is
+ * returned to the pool when the file is destroyed, while its cache is returned when the file is closed. Objects of
+ * opened directories are still allocated dynamically.
+ *
+ * \tparam ReadBlockSize is the read block size, bytes, which is also the size of read cache
+ * \tparam ProgramBlockSize is the program block size, bytes, which is also the size of program cache and caches of
+ * opened files
+ * \tparam Lookahead is the number of blocks to lookahead during block allocation, must be a multiple of 32
+ * \tparam MaxOpenFiles is the max number of concurrently opened files, [1; 32]
+ *
+ * \ingroup fileSystem
+ */
+
+template<size_t ReadBlockSize, size_t ProgramBlockSize, size_t Lookahead, size_t MaxOpenFiles>
+class StaticLittlefs1FileSystem : public Littlefs1FileSystem
+{
+	static_assert(ReadBlockSize != 0, "Invalid read block size!");
+	static_assert(ProgramBlockSize != 0, "Invalid program block size!");
+	static_assert(Lookahead != 0 && Lookahead % 32 == 0, "Invalid lookahead!");
+	static_assert(MaxOpenFiles != 0 && MaxOpenFiles <= 32, "Invalid max number of concurrently opened files!");
+
+public:
+
+	/**
+	 * \brief StaticLittlefs1FileSystem's constructor
+	 *
+	 * \param [in] memoryTechnologyDevice is a reference to memory technology device on which the file system will be
+	 * mounted
+	 * \param [in] eraseBlockSize is the erase block size, bytes, 0 to use default value of device, default - 0
+	 * \param [in] blocksCount is the number of erase blocks used for file system, 0 to use max value of device,
+	 * default - 0
+	 */
+
+	explicit StaticLittlefs1FileSystem(devices::MemoryTechnologyDevice& memoryTechnologyDevice,
+			const size_t eraseBlockSize = {}, const size_t blocksCount = {}) :
+					Littlefs1FileSystem{{readBuffer_.data(), programBuffer_.data(), lookaheadBuffer_.data(),
+							fileBuffers_.data(), fileStorages_.data(), MaxOpenFiles}, memoryTechnologyDevice,
+							ReadBlockSize, ProgramBlockSize, eraseBlockSize, blocksCount, Lookahead}
+	{
+
+	}
+
+private:
+
+	/// storage for read cache
+	std::array<uint8_t, ReadBlockSize> readBuffer_;
+
+	/// storage for program cache
+	std::array<uint8_t, ProgramBlockSize> programBuffer_;
+
+	/// storage for lookahead buffer
+	std::array<uint32_t, Lookahead / 32> lookaheadBuffer_;
+
+	/// storage for pool of objects of opened files
+	std::array<FileStorage, MaxOpenFiles> fileStorages_;
+
+	/// storage for pool of caches of opened files
+	std::array<uint8_t, ProgramBlockSize * MaxOpenFiles> fileBuffers_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_FILESYSTEM_STATICLITTLEFS1FILESYSTEM_HPP_
@@ -0,0 +1,102 @@
+/**
+ * \file
+ * \brief StaticLittlefs2FileSystem class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_FILESYSTEM_STATICLITTLEFS2FILESYSTEM_HPP_
+#define INCLUDE_DISTORTOS_FILESYSTEM_STATICLITTLEFS2FILESYSTEM_HPP_
+
+#include "distortos/FileSystem/Littlefs2FileSystem.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticLittlefs2FileSystem class is a variant of Littlefs2FileSystem that has automatic storage for all caches
+ * and opened files.
+ *
+ * Neither mounting of file system nor opening of files uses dynamic memory. Objects of opened files and their caches
+ * are taken from fixed pools, so at most \a MaxOpenFiles files may exist at the same time - storage of opened file is
+ * returned to the pool when the file is destroyed, while its cache is returned when the file is closed. Objects of
+ * opened directories are still allocated dynamically.
+ *
+ * \tparam CacheSize is the block cache size, bytes, must be a multiple of read/program block size and a factor of
+ * erase block size
+ * \tparam LookaheadSize is the number of blocks to lookahead during block allocation, must be a multiple of 64
+ * \tparam MaxOpenFiles is the max number of concurrently opened files, [1; 32]
+ *
+ * \ingroup fileSystem
+ */
+
+template<size_t CacheSize, size_t LookaheadSize, size_t MaxOpenFiles>
+class StaticLittlefs2FileSystem : public Littlefs2FileSystem
+{
+	static_assert(CacheSize != 0, "Invalid cache size!");
+	static_assert(LookaheadSize != 0 && LookaheadSize % 64 == 0, "Invalid lookahead size!");
+	static_assert(MaxOpenFiles != 0 && MaxOpenFiles <= 32, "Invalid max number of concurrently opened files!");
+
+public:
+
+	/**
+	 * \brief StaticLittlefs2FileSystem's constructor
+	 *
+	 * \param [in] memoryTechnologyDevice is a reference to memory technology device on which the file system will be
+	 * mounted
+	 * \param [in] readBlockSize is the read block size, bytes, 0 to use default value of device, default - 0
+	 * \param [in] programBlockSize is the program block size, bytes, 0 to use default value of device, default - 0
+	 * \param [in] eraseBlockSize is the erase block size, bytes, must be a multiple of read/program block size, 0 to
+	 * use default value of device, default - 0
+	 * \param [in] blocksCount is the number of erase blocks used for file system, 0 to use max value of device,
+	 * default - 0
+	 * \param [in] blockCycles is the number of erase cycles before file system moves metadata to another block, larger
+	 * values give better performance but less consistent wear distribution, recommended [100; 1000], -1 to disable
+	 * wear-leveling, default - 1000
+	 * \param [in] filenameLengthLimit is the limit of filename length, bytes, this value is stored in superblock, 0 to
+	 * use LFS2_NAME_MAX, default - 0
+	 * \param [in] fileSizeLimit is the limit of file size, bytes, this value is stored in superblock, 0 to use
+	 * LFS2_FILE_MAX, default - 0
+	 * \param [in] attributeSizeLimit is the limit of custom attribute size, bytes, this value is stored in superblock,
+	 * 0 to use LFS2_ATTR_MAX, default - 0
+	 */
+
+	explicit StaticLittlefs2FileSystem(devices::MemoryTechnologyDevice& memoryTechnologyDevice,
+			const size_t readBlockSize = {}, const size_t programBlockSize = {}, const size_t eraseBlockSize = {},
+			const size_t blocksCount = {}, const int32_t blockCycles = 1000, const size_t filenameLengthLimit = {},
+			const size_t fileSizeLimit = {}, const size_t attributeSizeLimit = {}) :
+					Littlefs2FileSystem{{readBuffer_.data(), programBuffer_.data(), lookaheadBuffer_.data(),
+							fileBuffers_.data(), fileStorages_.data(), MaxOpenFiles}, memoryTechnologyDevice,
+							readBlockSize, programBlockSize, eraseBlockSize, blocksCount, blockCycles, CacheSize,
+							LookaheadSize, filenameLengthLimit, fileSizeLimit, attributeSizeLimit}
+	{
+
+	}
+
+private:
+
+	/// storage for read cache
+	std::array<uint8_t, CacheSize> readBuffer_;
+
+	/// storage for program cache
+	std::array<uint8_t, CacheSize> programBuffer_;
+
+	/// storage for lookahead buffer
+	std::array<uint32_t, LookaheadSize / sizeof(uint32_t)> lookaheadBuffer_;
+
+	/// storage for pool of objects of opened files
+	std::array<FileStorage, MaxOpenFiles> fileStorages_;
+
+	/// storage for pool of caches of opened files
+	std::array<uint8_t, CacheSize * MaxOpenFiles> fileBuffers_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_FILESYSTEM_STATICLITTLEFS2FILESYSTEM_HPP_
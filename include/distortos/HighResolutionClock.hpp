@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \brief HighResolutionClock class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_HIGHRESOLUTIONCLOCK_HPP_
+#define INCLUDE_DISTORTOS_HIGHRESOLUTIONCLOCK_HPP_
+
+#include <chrono>
+
+namespace distortos
+{
+
+/**
+ * \brief HighResolutionClock is a std::chrono clock with resolution finer than one tick
+ *
+ * The clock combines the tick count of TickClock with the current value of hardware timer which generates ticks, so it
+ * has the same epoch as TickClock, but its resolution is limited only by the frequency of that timer.
+ *
+ * \ingroup clocks
+ */
+
+class HighResolutionClock
+{
+public:
+
+	/// type of counter
+	using rep = int64_t;
+
+	/// std::ratio type representing the period of the clock, seconds
+	using period = std::nano;
+
+	/// basic duration type of clock
+	using duration = std::chrono::duration<rep, period>;
+
+	/// basic time_point type of clock
+	using time_point = std::chrono::time_point<HighResolutionClock>;
+
+	/**
+	 * \return time_point representing the current value of the clock
+	 */
+
+	static time_point now();
+
+	/// this is a steady clock - it cannot be adjusted
+	constexpr static bool is_steady {true};
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_HIGHRESOLUTIONCLOCK_HPP_
@@ -45,6 +45,8 @@ namespace distortos
 template<typename T>
 class MessageQueue
 {
+	friend class QueueSet;
+
 public:
 
 	/// type of uninitialized storage for Entry with link
@@ -0,0 +1,224 @@
+/**
+ * \file
+ * \brief PeriodicRelease class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_PERIODICRELEASE_HPP_
+#define INCLUDE_DISTORTOS_PERIODICRELEASE_HPP_
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/SoftwareTimerCommon.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief PeriodicRelease class releases a periodic thread at exact multiples of its period.
+ *
+ * Releases are generated by a periodic software timer, which is restarted relative to its previous time point, so there
+ * is no cumulative drift, no matter how long the thread takes to process each activation. Typical usage:
+ *
+ * \code
+ * PeriodicRelease periodicRelease;
+ * periodicRelease.start(std::chrono::milliseconds{1});
+ * while (1)
+ * {
+ *     periodicRelease.wait();
+ *     // do the periodic work
+ * }
+ * \endcode
+ *
+ * Each activation of the thread which is still in progress when the next release happens is counted as an "overrun".
+ * Each release which happens when the previous one was not consumed yet is lost and counted as "missed".
+ *
+ * \ingroup threads
+ */
+
+class PeriodicRelease : private SoftwareTimerCommon
+{
+public:
+
+	/// statistics of periodic releases
+	struct Statistics
+	{
+		/// number of releases generated since start or since last call to resetStatistics()
+		uint64_t releases;
+
+		/// number of activations which did not finish before the next release
+		uint64_t overruns;
+
+		/// number of releases which were lost, because the previous release was still pending
+		uint64_t missedReleases;
+
+		/// min latency between release and resumption of the thread, valid only if \a releases is not 0
+		TickClock::duration minLatency;
+
+		/// max latency between release and resumption of the thread, valid only if \a releases is not 0
+		TickClock::duration maxLatency;
+	};
+
+	/**
+	 * \brief PeriodicRelease's constructor
+	 */
+
+	constexpr PeriodicRelease() :
+			SoftwareTimerCommon{},
+			semaphore_{0, 1},
+			statistics_{0, 0, 0, TickClock::duration::max(), TickClock::duration::zero()},
+			nextReleaseTimePoint_{},
+			pendingReleaseTimePoint_{},
+			period_{}
+	{
+
+	}
+
+	/**
+	 * \brief PeriodicRelease's destructor
+	 *
+	 * Releases are stopped.
+	 */
+
+	~PeriodicRelease() override;
+
+	/**
+	 * \return copy of current statistics of periodic releases
+	 */
+
+	Statistics getStatistics() const;
+
+	/**
+	 * \return period of releases, 0 if releases are not started
+	 */
+
+	TickClock::duration getPeriod() const
+	{
+		return period_;
+	}
+
+	/**
+	 * \return true if releases are generated, false otherwise
+	 */
+
+	bool isRunning() const override
+	{
+		return SoftwareTimerCommon::isRunning();
+	}
+
+	/**
+	 * \brief Resets statistics of periodic releases.
+	 */
+
+	void resetStatistics();
+
+	/**
+	 * \brief Starts generation of periodic releases.
+	 *
+	 * Any pending release is discarded and statistics are reset.
+	 *
+	 * \param [in] firstReleaseTimePoint is the time point of first release
+	 * \param [in] period is the period of releases
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a period is not greater than 0;
+	 */
+
+	int start(TickClock::time_point firstReleaseTimePoint, TickClock::duration period) override;
+
+	/**
+	 * \brief Starts generation of periodic releases.
+	 *
+	 * First release happens one period after the call to this function.
+	 *
+	 * \param [in] period is the period of releases
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a period is not greater than 0;
+	 */
+
+	int start(const TickClock::duration period)
+	{
+		return start(TickClock::now() + period, period);
+	}
+
+	/**
+	 * \brief Starts generation of periodic releases.
+	 *
+	 * First release happens one period after the call to this function.
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] period is the period of releases
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a period is not greater than 0;
+	 */
+
+	template<typename Rep, typename Period>
+	int start(const std::chrono::duration<Rep, Period> period)
+	{
+		return start(std::chrono::duration_cast<TickClock::duration>(period));
+	}
+
+	/**
+	 * \brief Stops generation of periodic releases.
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int stop() override;
+
+	/**
+	 * \brief Waits for next release.
+	 *
+	 * If the release already happened (previous activation took longer than the period), this function returns
+	 * immediately and the overrun is recorded.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 */
+
+	int wait();
+
+	PeriodicRelease(const PeriodicRelease&) = delete;
+	PeriodicRelease(PeriodicRelease&&) = delete;
+	const PeriodicRelease& operator=(const PeriodicRelease&) = delete;
+	PeriodicRelease& operator=(PeriodicRelease&&) = delete;
+
+private:
+
+	/**
+	 * \brief "Run" function of software timer
+	 *
+	 * Generates release by posting the semaphore.
+	 */
+
+	void run() override;
+
+	/// semaphore used to notify the thread about release
+	Semaphore semaphore_;
+
+	/// statistics of periodic releases
+	Statistics statistics_;
+
+	/// time point of next release
+	TickClock::time_point nextReleaseTimePoint_;
+
+	/// time point of release which is pending or was consumed most recently
+	TickClock::time_point pendingReleaseTimePoint_;
+
+	/// period of releases, 0 if releases are not started
+	TickClock::duration period_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_PERIODICRELEASE_HPP_
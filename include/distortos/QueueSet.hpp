@@ -0,0 +1,346 @@
+/**
+ * \file
+ * \brief QueueSet class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_QUEUESET_HPP_
+#define INCLUDE_DISTORTOS_QUEUESET_HPP_
+
+#include "distortos/FifoQueue.hpp"
+#include "distortos/MessageQueue.hpp"
+#include "distortos/RawFifoQueue.hpp"
+#include "distortos/RawMessageQueue.hpp"
+
+#include "distortos/internal/synchronization/notifyQueueSet.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief QueueSet class allows one thread to wait for any of several semaphores and queues at the same time.
+ *
+ * Semaphores, FifoQueue, RawFifoQueue, MessageQueue and RawMessageQueue objects can be added to the set. A member of
+ * the set is "ready" when non-blocking read from it would succeed - for semaphore this means that its value is not
+ * zero, for queues this means that there is at least one element available for popping. Waiting functions of the set
+ * return the address of ready member, which is the same as the address of the object passed to add(). Nothing is read
+ * from this member by the set - the caller should use non-blocking read (Semaphore::tryWait(), FifoQueue::tryPop(),
+ * ...) on it. If another thread consumed the element in the meantime, this read fails with EAGAIN and the caller
+ * should just wait for the set again.
+ *
+ * Each semaphore or queue may be a member of at most one set at a time. Members must not be moved or destroyed while
+ * they are in the set - destruction of a semaphore (also the one inside a queue) which is still a member of a set is
+ * detected with an assertion.
+ *
+ * \ingroup synchronization
+ */
+
+class QueueSet
+{
+	friend void internal::notifyQueueSet(QueueSet& queueSet);
+
+public:
+
+	/// single member of the set
+	struct Member
+	{
+		/// address of the object which was added to the set
+		const void* object;
+
+		/// pointer to semaphore which holds the number of "ready" items in \a object
+		Semaphore* semaphore;
+	};
+
+	/**
+	 * \brief QueueSet's constructor
+	 *
+	 * \param [in] members is a pointer to storage for members of the set
+	 * \param [in] maxMembers is the number of elements in \a members array
+	 */
+
+	constexpr QueueSet(Member* const members, const size_t maxMembers) :
+			blockedList_{},
+			members_{members},
+			maxMembers_{maxMembers},
+			membersCount_{},
+			nextMember_{}
+	{
+
+	}
+
+	/**
+	 * \brief QueueSet's destructor
+	 *
+	 * Removes all members from the set.
+	 *
+	 * \pre There are no threads waiting for the set.
+	 */
+
+	~QueueSet();
+
+	/**
+	 * \brief Adds FifoQueue to the set.
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] fifoQueue is a reference to FifoQueue which will be added to the set
+	 *
+	 * \return 0 if \a fifoQueue was successfully added to the set, error code otherwise:
+	 * - error codes returned by add(const void*, Semaphore&);
+	 */
+
+	template<typename T>
+	int add(FifoQueue<T>& fifoQueue)
+	{
+		return add(&fifoQueue, fifoQueue.fifoQueueBase_.getPopSemaphore());
+	}
+
+	/**
+	 * \brief Adds MessageQueue to the set.
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] messageQueue is a reference to MessageQueue which will be added to the set
+	 *
+	 * \return 0 if \a messageQueue was successfully added to the set, error code otherwise:
+	 * - error codes returned by add(const void*, Semaphore&);
+	 */
+
+	template<typename T>
+	int add(MessageQueue<T>& messageQueue)
+	{
+		return add(&messageQueue, messageQueue.messageQueueBase_.getPopSemaphore());
+	}
+
+	/**
+	 * \brief Adds RawFifoQueue to the set.
+	 *
+	 * \param [in] rawFifoQueue is a reference to RawFifoQueue which will be added to the set
+	 *
+	 * \return 0 if \a rawFifoQueue was successfully added to the set, error code otherwise:
+	 * - error codes returned by add(const void*, Semaphore&);
+	 */
+
+	int add(RawFifoQueue& rawFifoQueue)
+	{
+		return add(&rawFifoQueue, rawFifoQueue.fifoQueueBase_.getPopSemaphore());
+	}
+
+	/**
+	 * \brief Adds RawMessageQueue to the set.
+	 *
+	 * \param [in] rawMessageQueue is a reference to RawMessageQueue which will be added to the set
+	 *
+	 * \return 0 if \a rawMessageQueue was successfully added to the set, error code otherwise:
+	 * - error codes returned by add(const void*, Semaphore&);
+	 */
+
+	int add(RawMessageQueue& rawMessageQueue)
+	{
+		return add(&rawMessageQueue, rawMessageQueue.messageQueueBase_.getPopSemaphore());
+	}
+
+	/**
+	 * \brief Adds Semaphore to the set.
+	 *
+	 * \param [in] semaphore is a reference to Semaphore which will be added to the set
+	 *
+	 * \return 0 if \a semaphore was successfully added to the set, error code otherwise:
+	 * - error codes returned by add(const void*, Semaphore&);
+	 */
+
+	int add(Semaphore& semaphore)
+	{
+		return add(&semaphore, semaphore);
+	}
+
+	/**
+	 * \return maximum number of members in the set
+	 */
+
+	size_t getCapacity() const
+	{
+		return maxMembers_;
+	}
+
+	/**
+	 * \return current number of members in the set
+	 */
+
+	size_t getSize() const
+	{
+		return membersCount_;
+	}
+
+	/**
+	 * \brief Removes member from the set.
+	 *
+	 * \param [in] object is the address of object which will be removed from the set
+	 *
+	 * \return 0 if \a object was successfully removed from the set, error code otherwise:
+	 * - ENOENT - \a object is not a member of the set;
+	 */
+
+	int remove(const void* object);
+
+	/**
+	 * \brief Tries to find ready member of the set.
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and address of ready member; error codes:
+	 * - EAGAIN - no member of the set is ready;
+	 */
+
+	std::pair<int, const void*> tryWait();
+
+	/**
+	 * \brief Tries to wait for any member of the set to become ready for given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without finding ready member
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and address of ready member; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - no member of the set became ready before the specified timeout expired;
+	 */
+
+	std::pair<int, const void*> tryWaitFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to wait for any member of the set to become ready for given duration of time.
+	 *
+	 * Template variant of tryWaitFor(TickClock::duration duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without finding ready member
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and address of ready member; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - no member of the set became ready before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, const void*> tryWaitFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to wait for any member of the set to become ready until given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without finding ready member
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and address of ready member; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - no member of the set became ready before the specified timeout expired;
+	 */
+
+	std::pair<int, const void*> tryWaitUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to wait for any member of the set to become ready until given time point.
+	 *
+	 * Template variant of tryWaitUntil(TickClock::time_point timePoint).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without finding ready member
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and address of ready member; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - no member of the set became ready before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	std::pair<int, const void*> tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Waits for any member of the set to become ready.
+	 *
+	 * If more than one member is ready, they are returned in round-robin order, so that none of them is starved.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and address of ready member; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 */
+
+	std::pair<int, const void*> wait();
+
+	QueueSet(const QueueSet&) = delete;
+	QueueSet(QueueSet&&) = delete;
+	const QueueSet& operator=(const QueueSet&) = delete;
+	QueueSet& operator=(QueueSet&&) = delete;
+
+private:
+
+	/**
+	 * \brief Adds member to the set.
+	 *
+	 * \param [in] object is the address of object which will be added to the set
+	 * \param [in] semaphore is a reference to semaphore which holds the number of "ready" items in \a object
+	 *
+	 * \return 0 if \a object was successfully added to the set, error code otherwise:
+	 * - EBUSY - \a semaphore is already a member of a set;
+	 * - ENOSPC - the set is full;
+	 */
+
+	int add(const void* object, Semaphore& semaphore);
+
+	/**
+	 * \brief Finds ready member of the set.
+	 *
+	 * Search starts with the member following the one which was found previously.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 *
+	 * \return address of ready member, nullptr if no member of the set is ready
+	 */
+
+	const void* findReadyMember();
+
+	/**
+	 * \brief Notifies the set that one of its members may have become ready.
+	 *
+	 * First of the threads waiting for the set (if any) is unblocked.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 */
+
+	void notify();
+
+	/// ThreadControlBlock objects blocked on this set
+	internal::ThreadList blockedList_;
+
+	/// pointer to storage for members of the set
+	Member* members_;
+
+	/// number of elements in \a members_ array
+	size_t maxMembers_;
+
+	/// current number of members in the set
+	size_t membersCount_;
+
+	/// index of member from which next search for ready member will start
+	size_t nextMember_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_QUEUESET_HPP_
@@ -29,6 +29,8 @@ namespace distortos
 
 class RawFifoQueue
 {
+	friend class QueueSet;
+
 public:
 
 	/// unique_ptr (with deleter) to storage
@@ -32,6 +32,8 @@ namespace distortos
 
 class RawMessageQueue
 {
+	friend class QueueSet;
+
 public:
 
 	/// type of uninitialized storage for Entry with link
@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,11 +14,16 @@
 
 #include "distortos/internal/scheduler/ThreadList.hpp"
 
+#include "distortos/HighResolutionClock.hpp"
 #include "distortos/TickClock.hpp"
 
+#include <cassert>
+
 namespace distortos
 {
 
+class QueueSet;
+
 /**
  * \brief Semaphore is the basic synchronization primitive
  *
@@ -29,6 +34,8 @@ namespace distortos
 
 class Semaphore
 {
+	friend class QueueSet;
+
 public:
 
 	/// type used for semaphore's "value"
@@ -48,7 +55,8 @@ public:
 	constexpr explicit Semaphore(const Value value, const Value maxValue = std::numeric_limits<Value>::max()) :
 			blockedList_{},
 			value_{value < maxValue ? value : maxValue},
-			maxValue_{maxValue}
+			maxValue_{maxValue},
+			queueSet_{}
 	{
 
 	}
@@ -60,9 +68,14 @@ public:
 	 *
 	 * It is safe to destroy a semaphore upon which no threads are currently blocked. The effect of destroying a
 	 * semaphore upon which other threads are currently blocked is system error.
+	 *
+	 * \pre Semaphore is not a member of QueueSet.
 	 */
 
-	~Semaphore() = default;
+	~Semaphore()
+	{
+		assert(queueSet_ == nullptr);
+	}
 
 	/**
 	 * \return max value of the semaphore
@@ -98,6 +111,9 @@ public:
 	 * shall be unblocked, and if there is more than one highest priority thread blocked waiting for the semaphore, then
 	 * the highest priority thread that has been waiting the longest shall be unblocked.
 	 *
+	 * If the value is incremented and the semaphore is a member of QueueSet, one of the threads waiting for that set is
+	 * unblocked.
+	 *
 	 * \return 0 if the calling process successfully "posted" the semaphore, error code otherwise:
 	 * - EOVERFLOW - the maximum allowable value for a semaphore would be exceeded;
 	 */
@@ -165,6 +181,27 @@ public:
 		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration));
 	}
 
+	/**
+	 * \brief Tries to lock the semaphore for given duration of HighResolutionClock.
+	 *
+	 * Equivalent of `tryWaitUntil(HighResolutionClock::now() + duration)` - no additional tick is added. Only
+	 * HighResolutionClock::duration selects this overload, other duration types are rounded to ticks by template
+	 * variant of tryWaitFor().
+	 *
+	 * \attention Part of the wait shorter than one tick is spent polling the semaphore, at the priority of the calling
+	 * thread - see tryWaitUntil(HighResolutionClock::time_point).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the semaphore
+	 *
+	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	int tryWaitFor(HighResolutionClock::duration duration);
+
 	/**
 	 * \brief Tries to lock the semaphore until given time point.
 	 *
@@ -210,6 +247,52 @@ public:
 		return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
 	}
 
+	/**
+	 * \brief Tries to lock the semaphore until given time point of HighResolutionClock.
+	 *
+	 * The calling thread blocks as in tryWaitUntil(TickClock::time_point) until the beginning of the tick in which
+	 * \a timePoint lies. The remaining part of that tick is spent polling the semaphore with tryWait(), so the timeout
+	 * has the resolution of HighResolutionClock.
+	 *
+	 * \attention Polling lasts from the beginning of the tick in which \a timePoint lies until \a timePoint (or until
+	 * the semaphore is locked), so it is always shorter than one tick period (1 / DISTORTOS_TICK_FREQUENCY), e.g. up to
+	 * 1 ms with tick frequency of 1 kHz. The calling thread does not block during that time, so threads with lower
+	 * priority are not executed and threads with equal priority are executed only if round-robin scheduling preempts
+	 * the calling thread. Prefer tryWaitUntil(TickClock::time_point) when resolution of one tick is sufficient.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the semaphore
+	 *
+	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	int tryWaitUntil(HighResolutionClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to lock the semaphore until given time point of HighResolutionClock.
+	 *
+	 * Template variant of tryWaitUntil(HighResolutionClock::time_point timePoint).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the semaphore
+	 *
+	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryWaitUntil(const std::chrono::time_point<HighResolutionClock, Duration> timePoint)
+	{
+		return tryWaitUntil(std::chrono::time_point_cast<HighResolutionClock::duration>(timePoint));
+	}
+
 	/**
 	 * \brief Locks the semaphore.
 	 *
@@ -254,6 +337,9 @@ private:
 
 	/// max value of the semaphore
 	Value maxValue_;
+
+	/// pointer to QueueSet which is notified when the value of the semaphore is incremented, nullptr if none
+	QueueSet* queueSet_;
 };
 
 }	// namespace distortos
@@ -0,0 +1,62 @@
+/**
+ * \file
+ * \brief StaticQueueSet class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICQUEUESET_HPP_
+#define INCLUDE_DISTORTOS_STATICQUEUESET_HPP_
+
+#include "QueueSet.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticQueueSet class is a variant of QueueSet that has automatic storage for members of the set.
+ *
+ * \tparam MaxMembers is the maximum number of members in the set
+ *
+ * \ingroup synchronization
+ */
+
+template<size_t MaxMembers>
+class StaticQueueSet : public QueueSet
+{
+public:
+
+	/**
+	 * \brief StaticQueueSet's constructor
+	 */
+
+	explicit StaticQueueSet() :
+			QueueSet{members_.data(), MaxMembers}
+	{
+
+	}
+
+	/**
+	 * \return maximum number of members in the set
+	 */
+
+	constexpr static size_t getCapacity()
+	{
+		return MaxMembers;
+	}
+
+private:
+
+	/// storage for members of the set
+	std::array<Member, MaxMembers> members_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICQUEUESET_HPP_
@@ -0,0 +1,449 @@
+/**
+ * \file
+ * \brief Static system description header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICSYSTEMDESCRIPTION_HPP_
+#define INCLUDE_DISTORTOS_STATICSYSTEMDESCRIPTION_HPP_
+
+#include "distortos/Mutex.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticMessageQueue.hpp"
+#include "distortos/StaticThread.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \return true
+ */
+
+constexpr bool allOf()
+{
+	return true;
+}
+
+/**
+ * \param [in] first is the first value
+ * \param [in] rest are remaining values
+ *
+ * \return true if all values are true, false otherwise
+ */
+
+template<typename... Rest>
+constexpr bool allOf(const bool first, const Rest... rest)
+{
+	return first == true && allOf(rest...);
+}
+
+/**
+ * \return 0
+ */
+
+constexpr size_t maxOf()
+{
+	return 0;
+}
+
+/**
+ * \param [in] first is the first value
+ * \param [in] rest are remaining values
+ *
+ * \return the greatest of values
+ */
+
+template<typename... Rest>
+constexpr size_t maxOf(const size_t first, const Rest... rest)
+{
+	return first > maxOf(rest...) ? first : maxOf(rest...);
+}
+
+/**
+ * \return 0
+ */
+
+constexpr size_t sumOf()
+{
+	return 0;
+}
+
+/**
+ * \param [in] first is the first value
+ * \param [in] rest are remaining values
+ *
+ * \return sum of values
+ */
+
+template<typename... Rest>
+constexpr size_t sumOf(const size_t first, const Rest... rest)
+{
+	return first + sumOf(rest...);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Properties of description which are relevant for checks of relations between objects.
+ *
+ * Primary template is used for descriptions of objects other than threads and for `void`.
+ *
+ * \tparam Description is the type of description
+ */
+
+template<typename Description>
+struct DescriptionTraits
+{
+	/// period of thread, ticks, 0 for non-periodic thread or for object which is not a thread
+	constexpr static TickClock::rep period {};
+
+	/// priority of thread, 0 for object which is not a thread
+	constexpr static uint8_t priority {};
+
+	/// size of stack of thread (including stack guard), bytes, 0 for object which is not a thread
+	constexpr static size_t stackSize {};
+};
+
+/**
+ * \brief Checks whether priorities of two threads are rate-monotonic.
+ *
+ * \tparam First is the type of description of first thread
+ * \tparam Second is the type of description of second thread
+ *
+ * \return true if at least one of the threads is not periodic or if thread with shorter period has the same or higher
+ * priority, false otherwise
+ */
+
+template<typename First, typename Second>
+constexpr bool isRateMonotonicPair()
+{
+	using FirstTraits = DescriptionTraits<First>;
+	using SecondTraits = DescriptionTraits<Second>;
+	return FirstTraits::period == 0 || SecondTraits::period == 0 ||
+			(FirstTraits::period < SecondTraits::period && FirstTraits::priority >= SecondTraits::priority) ||
+			(SecondTraits::period < FirstTraits::period && SecondTraits::priority >= FirstTraits::priority) ||
+			FirstTraits::period == SecondTraits::period;
+}
+
+/**
+ * \brief Checks whether priorities of all threads are rate-monotonic.
+ *
+ * Primary template is used for empty list of descriptions.
+ *
+ * \tparam Descriptions are types of descriptions
+ */
+
+template<typename... Descriptions>
+struct RateMonotonicChecker
+{
+	/// true if priorities of all threads are rate-monotonic, false otherwise
+	constexpr static bool value {true};
+};
+
+/**
+ * \brief Checks whether priorities of all threads are rate-monotonic.
+ *
+ * \tparam First is the type of first description
+ * \tparam Rest are types of remaining descriptions
+ */
+
+template<typename First, typename... Rest>
+struct RateMonotonicChecker<First, Rest...>
+{
+	/// true if priorities of all threads are rate-monotonic, false otherwise
+	constexpr static bool value {allOf(isRateMonotonicPair<First, Rest>()...) == true &&
+			RateMonotonicChecker<Rest...>::value == true};
+};
+
+}	// namespace internal
+
+/**
+ * \brief Description of thread.
+ *
+ * Size of thread object depends on the types of function and its arguments, which are stored in the object. They must
+ * be given as \a Function and \a Args if the thread is not executing a plain function without arguments, otherwise
+ * make() fails to compile, as the thread would not fit in RAM accounted for by the description.
+ *
+ * \tparam Priority is the priority of thread
+ * \tparam StackSize is the size of stack, bytes
+ * \tparam Period is the period of thread, ticks, 0 for non-periodic thread
+ * \tparam Function is the type of function that will be executed in separate thread, default - plain function
+ * \tparam Args are the types of arguments for \a Function
+ *
+ * \ingroup staticSystemDescription
+ */
+
+template<uint8_t Priority, size_t StackSize, TickClock::rep Period = 0, typename Function = void(&)(),
+		typename... Args>
+struct ThreadDescription
+{
+	static_assert(Period >= 0, "Period of thread must not be negative!");
+
+	/// type of thread which is instantiated from this description
+	template<typename ObjectFunction, typename... ObjectArgs>
+	using Object = StaticThread<StackSize, false, 0, 0, ObjectFunction, ObjectArgs...>;
+
+	/// period of thread, ticks, 0 for non-periodic thread
+	constexpr static TickClock::rep period {Period};
+
+	/// priority of thread
+	constexpr static uint8_t priority {Priority};
+
+	/// size of RAM used by thread executing \a Function with \a Args, bytes
+	constexpr static size_t ramSize {sizeof(Object<Function, Args...>)};
+
+	/// size of stack adjusted to alignment requirements (including stack guard), bytes
+	constexpr static size_t stackSize {(StackSize + DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT - 1) /
+			DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT * DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT +
+			internal::stackGuardSize};
+
+	/**
+	 * \brief Makes thread described by this description.
+	 *
+	 * \tparam MakeFunction is the function that will be executed in separate thread
+	 * \tparam MakeArgs are the arguments for \a MakeFunction
+	 *
+	 * \param [in] function is a function that will be executed in separate thread
+	 * \param [in] args are arguments for \a function
+	 *
+	 * \return thread described by this description
+	 */
+
+	template<typename MakeFunction, typename... MakeArgs>
+	static Object<MakeFunction, MakeArgs...> make(MakeFunction&& function, MakeArgs&&... args)
+	{
+		static_assert(sizeof(Object<MakeFunction, MakeArgs...>) <= ramSize,
+				"Thread uses more RAM than its description - types of function and arguments must be described!");
+
+		return makeStaticThread<StackSize>(Priority, std::forward<MakeFunction>(function),
+				std::forward<MakeArgs>(args)...);
+	}
+};
+
+namespace internal
+{
+
+/**
+ * \brief Properties of description of thread.
+ *
+ * \tparam Priority is the priority of thread
+ * \tparam StackSize is the size of stack, bytes
+ * \tparam Period is the period of thread, ticks, 0 for non-periodic thread
+ * \tparam Function is the type of function that will be executed in separate thread
+ * \tparam Args are the types of arguments for \a Function
+ */
+
+template<uint8_t Priority, size_t StackSize, TickClock::rep Period, typename Function, typename... Args>
+struct DescriptionTraits<ThreadDescription<Priority, StackSize, Period, Function, Args...>>
+{
+	/// period of thread, ticks, 0 for non-periodic thread
+	constexpr static TickClock::rep period {Period};
+
+	/// priority of thread
+	constexpr static uint8_t priority {Priority};
+
+	/// size of stack of thread (including stack guard), bytes
+	constexpr static size_t stackSize {ThreadDescription<Priority, StackSize, Period, Function, Args...>::stackSize};
+};
+
+/**
+ * \brief Checks whether queue is large enough.
+ *
+ * \tparam QueueSize is the maximum number of elements in queue
+ * \tparam Producer is the type of description of thread which pushes one element to the queue in each period, `void`
+ * if unknown
+ * \tparam Consumer is the type of description of thread which empties the queue in each period, `void` if unknown
+ *
+ * \return true if at least one of the threads is not periodic or if the queue can hold all elements pushed by
+ * \a Producer during one period of \a Consumer, false otherwise
+ */
+
+template<size_t QueueSize, typename Producer, typename Consumer>
+constexpr bool isQueueLargeEnough()
+{
+	using ProducerTraits = DescriptionTraits<Producer>;
+	using ConsumerTraits = DescriptionTraits<Consumer>;
+	return ProducerTraits::period == 0 || ConsumerTraits::period == 0 ||
+			static_cast<TickClock::rep>(QueueSize) >=
+					(ConsumerTraits::period + ProducerTraits::period - 1) / ProducerTraits::period;
+}
+
+}	// namespace internal
+
+/**
+ * \brief Description of FifoQueue.
+ *
+ * \tparam T is the type of data in queue
+ * \tparam QueueSize is the maximum number of elements in queue
+ * \tparam Producer is the type of description of thread which pushes one element to the queue in each period, `void`
+ * if unknown
+ * \tparam Consumer is the type of description of thread which empties the queue in each period, `void` if unknown
+ *
+ * \ingroup staticSystemDescription
+ */
+
+template<typename T, size_t QueueSize, typename Producer = void, typename Consumer = void>
+struct FifoQueueDescription
+{
+	static_assert(internal::isQueueLargeEnough<QueueSize, Producer, Consumer>() == true,
+			"Queue is too small for elements pushed by producer during one period of consumer!");
+
+	/// type of queue which is instantiated from this description
+	using Object = StaticFifoQueue<T, QueueSize>;
+
+	/// size of RAM used by queue, bytes
+	constexpr static size_t ramSize {sizeof(Object)};
+};
+
+/**
+ * \brief Description of MessageQueue.
+ *
+ * \tparam T is the type of data in queue
+ * \tparam QueueSize is the maximum number of elements in queue
+ * \tparam Producer is the type of description of thread which pushes one element to the queue in each period, `void`
+ * if unknown
+ * \tparam Consumer is the type of description of thread which empties the queue in each period, `void` if unknown
+ *
+ * \ingroup staticSystemDescription
+ */
+
+template<typename T, size_t QueueSize, typename Producer = void, typename Consumer = void>
+struct MessageQueueDescription
+{
+	static_assert(internal::isQueueLargeEnough<QueueSize, Producer, Consumer>() == true,
+			"Queue is too small for elements pushed by producer during one period of consumer!");
+
+	/// type of queue which is instantiated from this description
+	using Object = StaticMessageQueue<T, QueueSize>;
+
+	/// size of RAM used by queue, bytes
+	constexpr static size_t ramSize {sizeof(Object)};
+};
+
+/**
+ * \brief Description of Mutex with priority protect protocol.
+ *
+ * \tparam PriorityCeiling is the priority ceiling of mutex
+ * \tparam Users are types of descriptions of threads which lock the mutex
+ *
+ * \ingroup staticSystemDescription
+ */
+
+template<uint8_t PriorityCeiling, typename... Users>
+struct MutexDescription
+{
+	static_assert(internal::maxOf(internal::DescriptionTraits<Users>::priority...) <= PriorityCeiling,
+			"Priority ceiling of mutex is lower than priority of one of the threads which lock it!");
+
+	/// Mutex which is instantiated from this description, constant-initialized
+	class Object : public Mutex
+	{
+	public:
+
+		/**
+		 * \brief Object's constructor
+		 */
+
+		constexpr Object() :
+				Mutex{Mutex::Protocol::priorityProtect, PriorityCeiling}
+		{
+
+		}
+	};
+
+	/// size of RAM used by mutex, bytes
+	constexpr static size_t ramSize {sizeof(Object)};
+};
+
+/**
+ * \brief Description of Semaphore.
+ *
+ * \tparam InitialValue is the initial value of semaphore
+ * \tparam MaxValue is the max value of semaphore
+ *
+ * \ingroup staticSystemDescription
+ */
+
+template<Semaphore::Value InitialValue, Semaphore::Value MaxValue = std::numeric_limits<Semaphore::Value>::max()>
+struct SemaphoreDescription
+{
+	static_assert(InitialValue <= MaxValue, "Initial value of semaphore is greater than its max value!");
+
+	/// Semaphore which is instantiated from this description, constant-initialized
+	class Object : public Semaphore
+	{
+	public:
+
+		/**
+		 * \brief Object's constructor
+		 */
+
+		constexpr Object() :
+				Semaphore{InitialValue, MaxValue}
+		{
+
+		}
+	};
+
+	/// size of RAM used by semaphore, bytes
+	constexpr static size_t ramSize {sizeof(Object)};
+};
+
+/**
+ * \brief Description of whole system.
+ *
+ * Typical usage:
+ *
+ * \code
+ * using SensorThread = ThreadDescription<10, 1024, 10>;
+ * using LoggerThread = ThreadDescription<5, 2048, 100, void(&)(int), int>;
+ * using SensorMutex = MutexDescription<10, SensorThread, LoggerThread>;
+ * using SampleQueue = FifoQueueDescription<Sample, 10, SensorThread, LoggerThread>;
+ * using System = SystemDescription<16 * 1024, SensorThread, LoggerThread, SensorMutex, SampleQueue>;
+ * static_assert(System::isRateMonotonic == true, "Priorities are not rate-monotonic!");
+ *
+ * SensorMutex::Object sensorMutex;	// constant-initialized, no run-time construction
+ * SampleQueue::Object sampleQueue;
+ * auto sensorThread = SensorThread::make(sensorThreadFunction);
+ * auto loggerThread = LoggerThread::make(loggerThreadFunction, logLevel);
+ * \endcode
+ *
+ * \tparam RamBudget is the amount of RAM available for objects described by \a Descriptions, bytes
+ * \tparam Descriptions are types of descriptions of objects
+ *
+ * \ingroup staticSystemDescription
+ */
+
+template<size_t RamBudget, typename... Descriptions>
+struct SystemDescription
+{
+	/// true if priorities of all periodic threads are rate-monotonic (shorter period - not lower priority), false
+	/// otherwise
+	constexpr static bool isRateMonotonic {internal::RateMonotonicChecker<Descriptions...>::value};
+
+	/// size of RAM used by all described objects, bytes
+	constexpr static size_t ramSize {internal::sumOf(Descriptions::ramSize...)};
+
+	/// total size of stacks (including stack guards) of all described threads, bytes
+	constexpr static size_t stackSize {internal::sumOf(internal::DescriptionTraits<Descriptions>::stackSize...)};
+
+	static_assert(ramSize <= RamBudget, "Described objects do not fit in RAM budget!");
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICSYSTEMDESCRIPTION_HPP_
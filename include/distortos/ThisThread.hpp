@@ -2,7 +2,7 @@
  * \file
  * \brief ThisThread namespace header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_THISTHREAD_HPP_
 #define INCLUDE_DISTORTOS_THISTHREAD_HPP_
 
+#include "distortos/HighResolutionClock.hpp"
 #include "distortos/SchedulingPolicy.hpp"
 #include "distortos/TickClock.hpp"
 
@@ -49,6 +50,26 @@ int detach();
 
 #endif	// def DISTORTOS_THREAD_DETACH_ENABLE
 
+#ifdef DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+
+/**
+ * \brief Declares that calling (current) thread doesn't use floating-point unit.
+ *
+ * Such thread never owns the context of floating-point unit, so switching to and from it never requires any save or
+ * restore of floating-point registers. Access to floating-point unit is blocked while this thread is running (starting
+ * with the next context switch to this thread), so any floating-point instruction executed by this thread is detected
+ * and causes fatal error. Floating-point instructions executed by interrupt handlers are still allowed.
+ *
+ * This function should be called before the thread uses floating-point unit for the first time, preferably as the
+ * first thing done by thread's function. The declaration cannot be revoked.
+ *
+ * \warning This function must not be called from interrupt context!
+ */
+
+void declareFpuFree();
+
+#endif	// def DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+
 /**
  * \brief Exits calling (current) thread.
  *
@@ -174,6 +195,27 @@ int sleepFor(const std::chrono::duration<Rep, Period> duration)
 	return sleepFor(std::chrono::duration_cast<TickClock::duration>(duration));
 }
 
+/**
+ * \brief Makes the calling (current) thread sleep for at least given duration of HighResolutionClock.
+ *
+ * Equivalent of `sleepUntil(HighResolutionClock::now() + duration)` - no additional tick is added and the thread is
+ * woken with the resolution of HighResolutionClock. Only HighResolutionClock::duration selects this overload, other
+ * duration types (e.g. std::chrono::microseconds) are rounded to ticks by template variant of sleepFor(), so they
+ * should be converted with `std::chrono::duration_cast<HighResolutionClock::duration>()` first.
+ *
+ * \attention Part of the sleep shorter than one tick is waited for actively, at the priority of the calling thread -
+ * see sleepUntil(HighResolutionClock::time_point).
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] duration is the duration after which the thread will be woken
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the sleep was interrupted by an unmasked, caught signal;
+ */
+
+int sleepFor(HighResolutionClock::duration duration);
+
 /**
  * \brief Makes the calling (current) thread sleep until some time point is reached.
  *
@@ -210,6 +252,49 @@ int sleepUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
 	return sleepUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
 }
 
+/**
+ * \brief Makes the calling (current) thread sleep until some time point of HighResolutionClock is reached.
+ *
+ * Current thread's state is changed to "sleeping" until the beginning of the tick in which \a timePoint lies. The
+ * remaining part of that tick is waited for actively, by polling HighResolutionClock, so the thread is woken with the
+ * resolution of that clock instead of the resolution of TickClock. This allows timeouts shorter than one tick, e.g.
+ * `ThisThread::sleepUntil(HighResolutionClock::now() + std::chrono::microseconds{100})`.
+ *
+ * \attention Active waiting lasts from the beginning of the tick in which \a timePoint lies until \a timePoint, so it
+ * is always shorter than one tick period (1 / DISTORTOS_TICK_FREQUENCY), e.g. up to 1 ms with tick frequency of 1 kHz.
+ * The calling thread does not block during that time, so threads with lower priority are not executed and threads with
+ * equal priority are executed only if round-robin scheduling preempts the calling thread. Prefer
+ * sleepUntil(TickClock::time_point) when resolution of one tick is sufficient.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] timePoint is the time point at which the thread will be woken
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the sleep was interrupted by an unmasked, caught signal;
+ */
+
+int sleepUntil(HighResolutionClock::time_point timePoint);
+
+/**
+ * \brief Makes the calling (current) thread sleep until some time point of HighResolutionClock is reached.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Duration is a std::chrono::duration type used to measure duration
+ *
+ * \param [in] timePoint is the time point at which the thread will be woken
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the sleep was interrupted by an unmasked, caught signal;
+ */
+
+template<typename Duration>
+int sleepUntil(const std::chrono::time_point<HighResolutionClock, Duration> timePoint)
+{
+	return sleepUntil(std::chrono::time_point_cast<HighResolutionClock::duration>(timePoint));
+}
+
 /**
  * \brief Yields time slot of the scheduler to next thread.
  *
@@ -53,6 +53,8 @@ enum class ThreadState : uint8_t
 
 	/// internal thread object was detached
 	detached,
+	/// thread is blocked on QueueSet
+	blockedOnQueueSet,
 };
 
 }	// namespace distortos
@@ -0,0 +1,87 @@
+/**
+ * \file
+ * \brief TickSource class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_TICKSOURCE_HPP_
+#define INCLUDE_DISTORTOS_TICKSOURCE_HPP_
+
+#include <chrono>
+
+namespace distortos
+{
+
+/**
+ * \brief TickSource class is an interface for hardware which generates tick interrupts of scheduler.
+ *
+ * By default architecture's tick source is used (SysTick on ARM Cortex-M). Board or application may select another
+ * one - e.g. based on 32-bit general-purpose timer or on low-power timer, which keeps running in low-power modes - by
+ * defining getTickSource() function.
+ *
+ * \ingroup clocks
+ */
+
+class TickSource
+{
+public:
+
+	/**
+	 * \brief TickSource's destructor
+	 */
+
+	virtual ~TickSource() = default;
+
+	/**
+	 * \brief Gets time which passed since last tick.
+	 *
+	 * \return time which passed since last tick which was handled with handleTick(); may exceed tick period if the
+	 * interrupt of next tick is pending
+	 */
+
+	virtual std::chrono::nanoseconds getTimeSinceTick() const = 0;
+
+	/**
+	 * \brief Handles single tick.
+	 *
+	 * Calls Scheduler::tickInterruptHandler() and requests context switch if needed. This function also checks stack
+	 * pointer range when this functionality is enabled - if the check fails, FATAL_ERROR() is called.
+	 *
+	 * \attention This function must be called exactly once per each tick, from interrupt handler of tick source.
+	 */
+
+	static void handleTick();
+
+	/**
+	 * \brief Starts generation of ticks with DISTORTOS_TICK_FREQUENCY.
+	 *
+	 * This function is called once, from low-level initializer which starts scheduling - before constructors for global
+	 * and static objects are executed, so the object must be constant-initialized (have constexpr constructor) or must
+	 * be constructed explicitly by another low-level initializer. Priority of interrupt of tick source must allow use
+	 * of kernel's functions - the lowest possible priority is recommended.
+	 */
+
+	virtual void start() = 0;
+};
+
+/**
+ * \brief Gets tick source used by the system.
+ *
+ * \note Architecture provides weak definition of this function which returns the default tick source. Board or
+ * application may provide its own definition to select another tick source.
+ *
+ * \return reference to tick source used by the system
+ *
+ * \ingroup clocks
+ */
+
+TickSource& getTickSource();
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_TICKSOURCE_HPP_
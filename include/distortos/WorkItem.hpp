@@ -0,0 +1,121 @@
+/**
+ * \file
+ * \brief WorkItem class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_WORKITEM_HPP_
+#define INCLUDE_DISTORTOS_WORKITEM_HPP_
+
+#include "estd/IntrusiveList.hpp"
+
+#include <cassert>
+
+namespace distortos
+{
+
+/**
+ * \brief WorkItem class is a piece of work deferred from interrupt context to thread context.
+ *
+ * Work item is submitted with WorkQueue::submit() - usually from an interrupt handler - and its function is executed by
+ * the thread which executes WorkQueue::run(), with interrupts enabled. Submitting a work item which is already pending
+ * has no effect, so repeated requests which arrive before the function is executed are coalesced into one execution.
+ *
+ * \ingroup synchronization
+ */
+
+class WorkItem
+{
+	friend class WorkQueue;
+
+public:
+
+	/// type of function executed by work item
+	using Function = void(WorkItem& workItem);
+
+	/**
+	 * \brief WorkItem's constructor
+	 *
+	 * \param [in] function is a reference to function executed by work item
+	 * \param [in] context is a pointer to user's data associated with work item, default - nullptr
+	 * \param [in] priority is the priority of work item, pending work items with higher priority are executed first,
+	 * default - 0
+	 */
+
+	constexpr explicit WorkItem(Function& function, void* const context = {}, const uint8_t priority = {}) :
+			node_{},
+			function_{function},
+			context_{context},
+			priority_{priority},
+			pending_{}
+	{
+
+	}
+
+	/**
+	 * \brief WorkItem's destructor
+	 *
+	 * \pre Work item is not pending.
+	 */
+
+	~WorkItem()
+	{
+		assert(pending_ == false);
+	}
+
+	/**
+	 * \return pointer to user's data associated with work item
+	 */
+
+	void* getContext() const
+	{
+		return context_;
+	}
+
+	/**
+	 * \return priority of work item
+	 */
+
+	uint8_t getPriority() const
+	{
+		return priority_;
+	}
+
+	/**
+	 * \return true if work item was submitted and its execution did not start yet, false otherwise
+	 */
+
+	bool isPending() const
+	{
+		return pending_;
+	}
+
+	WorkItem(const WorkItem&) = delete;
+	WorkItem& operator=(const WorkItem&) = delete;
+
+private:
+
+	/// node for intrusive list of pending work items
+	estd::IntrusiveListNode node_;
+
+	/// reference to function executed by work item
+	Function& function_;
+
+	/// pointer to user's data associated with work item
+	void* context_;
+
+	/// priority of work item
+	uint8_t priority_;
+
+	/// true if work item was submitted and its execution did not start yet, false otherwise
+	volatile bool pending_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_WORKITEM_HPP_
@@ -0,0 +1,156 @@
+/**
+ * \file
+ * \brief WorkQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_WORKQUEUE_HPP_
+#define INCLUDE_DISTORTOS_WORKQUEUE_HPP_
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/WorkItem.hpp"
+
+#include "estd/SortedIntrusiveList.hpp"
+
+namespace distortos
+{
+
+/// functor which gives descending priority order of work items on the list
+struct WorkItemDescendingPriority
+{
+	/**
+	 * \brief WorkItemDescendingPriority's constructor
+	 */
+
+	constexpr WorkItemDescendingPriority()
+	{
+
+	}
+
+	/**
+	 * \brief WorkItemDescendingPriority's function call operator
+	 *
+	 * \param [in] left is the object on the left-hand side of comparison
+	 * \param [in] right is the object on the right-hand side of comparison
+	 *
+	 * \return true if left's priority is less than right's priority
+	 */
+
+	bool operator()(const WorkItem& left, const WorkItem& right) const
+	{
+		return left.getPriority() < right.getPriority();
+	}
+};
+
+/**
+ * \brief WorkQueue class executes work items deferred from interrupt context in a worker thread.
+ *
+ * Interrupt handlers submit work items with submit() and return immediately, while the functions of work items are
+ * executed by run(), which must be executed by the worker thread, for example:
+ *
+ *     distortos::WorkQueue workQueue;
+ *     auto worker = distortos::makeAndStartStaticThread<1024>(priority, &WorkQueue::run, &workQueue);
+ *
+ * Pending work items are executed in the order of descending priority and in FIFO order for work items with equal
+ * priority. Priority of worker thread decides how deferred work competes with other threads.
+ *
+ * \ingroup synchronization
+ */
+
+class WorkQueue
+{
+public:
+
+	/**
+	 * \brief WorkQueue's constructor
+	 */
+
+	constexpr WorkQueue() :
+			workItems_{},
+			semaphore_{0},
+			stopRequested_{}
+	{
+
+	}
+
+	/**
+	 * \brief WorkQueue's destructor
+	 *
+	 * \pre No work item is pending.
+	 */
+
+	~WorkQueue();
+
+	/**
+	 * \brief Cancels pending work item.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] workItem is a reference to cancelled work item
+	 *
+	 * \return true if work item was pending and it was cancelled, false if it was not pending
+	 */
+
+	bool cancel(WorkItem& workItem);
+
+	/**
+	 * \brief Executes submitted work items.
+	 *
+	 * This function should be executed by the worker thread. It returns when stop() is called and all work items
+	 * submitted before that call are executed.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 */
+
+	void run();
+
+	/**
+	 * \brief Requests run() to return after executing all work items submitted so far.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int stop();
+
+	/**
+	 * \brief Submits work item for execution.
+	 *
+	 * If the work item is already pending, this function does nothing. Work item stops being pending just before its
+	 * function is executed, so it may be submitted again by that function or while that function is executed.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] workItem is a reference to submitted work item, it must not be destroyed while it is pending
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int submit(WorkItem& workItem);
+
+	WorkQueue(const WorkQueue&) = delete;
+	WorkQueue& operator=(const WorkQueue&) = delete;
+
+private:
+
+	/// list of pending work items
+	estd::SortedIntrusiveList<WorkItemDescendingPriority, WorkItem, &WorkItem::node_> workItems_;
+
+	/// semaphore with the number of submitted work items and stop requests
+	Semaphore semaphore_;
+
+	/// true if run() should return after executing all work items submitted so far, false otherwise
+	bool stopRequested_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_WORKQUEUE_HPP_
@@ -0,0 +1,118 @@
+/**
+ * \file
+ * \brief ZeroLatencyNotification class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ZEROLATENCYNOTIFICATION_HPP_
+#define INCLUDE_DISTORTOS_ZEROLATENCYNOTIFICATION_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+#include "distortos/internal/synchronization/deliverZeroLatencyNotifications.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace distortos
+{
+
+class Semaphore;
+
+/**
+ * \brief ZeroLatencyNotification class is a lock-free path from interrupts with priority above the kernel's BASEPRI
+ * (see DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI) to a Semaphore.
+ *
+ * Such "zero-latency" interrupts are never masked by the kernel, so they must not use any kernel API. notify() only
+ * increments an atomic counter, links the object into a lock-free list of pending notifications and requests context
+ * switch. The counter is converted to the same number of Semaphore::post() calls by the kernel-aware context switch
+ * handler, before it selects the thread to run, so the woken thread may be switched to in the same handler execution.
+ *
+ *     distortos::Semaphore semaphore {0};
+ *     distortos::ZeroLatencyNotification notification {semaphore};
+ *
+ *     extern "C" void TIM1_UP_TIM16_IRQHandler()	// priority above the kernel's BASEPRI
+ *     {
+ *         ...
+ *         notification.notify();
+ *     }
+ *
+ * \note Posts which fail (e.g. because the semaphore would overflow) are dropped.
+ *
+ * \note This class is available only if "distortos_Scheduler_13_Zero_latency_notifications" option is enabled.
+ *
+ * \ingroup synchronization
+ */
+
+class ZeroLatencyNotification
+{
+	friend void internal::deliverZeroLatencyNotifications();
+
+public:
+
+	/**
+	 * \brief ZeroLatencyNotification's constructor
+	 *
+	 * \param [in] semaphore is a reference to semaphore which will be posted for each notification
+	 */
+
+	constexpr explicit ZeroLatencyNotification(Semaphore& semaphore) :
+			semaphore_{semaphore},
+			next_{},
+			count_{},
+			queued_{}
+	{
+
+	}
+
+	/**
+	 * \return reference to semaphore which is posted for each notification
+	 */
+
+	Semaphore& getSemaphore() const
+	{
+		return semaphore_;
+	}
+
+	/**
+	 * \brief Sends notification.
+	 *
+	 * The semaphore is posted when the processor leaves all sections with masked interrupts and all kernel-aware
+	 * interrupts.
+	 *
+	 * \note This function may be called from interrupt context of any priority, including interrupts with priority
+	 * above the kernel's BASEPRI.
+	 */
+
+	void notify();
+
+	ZeroLatencyNotification(const ZeroLatencyNotification&) = delete;
+	ZeroLatencyNotification& operator=(const ZeroLatencyNotification&) = delete;
+
+private:
+
+	/// reference to semaphore which is posted for each notification
+	Semaphore& semaphore_;
+
+	/// next object on the list of pending notifications
+	ZeroLatencyNotification* next_;
+
+	/// number of notifications which were not delivered yet
+	std::atomic<uint32_t> count_;
+
+	/// true if the object is on the list of pending notifications, false otherwise
+	std::atomic<bool> queued_;
+};
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_ZEROLATENCYNOTIFICATION_HPP_
@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief getTimeSinceTick() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_GETTIMESINCETICK_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_GETTIMESINCETICK_HPP_
+
+#include <chrono>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific measurement of time which passed since the last tick.
+ *
+ * The value is read from the hardware timer which generates ticks and is used by HighResolutionClock to interpolate
+ * between consecutive ticks.
+ *
+ * \pre Interrupt masking is enabled.
+ *
+ * \return time which passed since the last tick counted by the scheduler; if the tick interrupt is pending, one tick
+ * period is added to the returned value
+ */
+
+std::chrono::nanoseconds getTimeSinceTick();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_GETTIMESINCETICK_HPP_
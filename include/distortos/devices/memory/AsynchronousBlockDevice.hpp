@@ -0,0 +1,152 @@
+/**
+ * \file
+ * \brief AsynchronousBlockDevice class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DEVICES_MEMORY_ASYNCHRONOUSBLOCKDEVICE_HPP_
+#define INCLUDE_DISTORTOS_DEVICES_MEMORY_ASYNCHRONOUSBLOCKDEVICE_HPP_
+
+#include "distortos/devices/memory/BlockDeviceRequest.hpp"
+
+namespace distortos
+{
+
+namespace devices
+{
+
+class BlockDevice;
+
+/**
+ * \brief AsynchronousBlockDevice class is an adapter which executes requests for associated block device in a worker
+ * thread.
+ *
+ * Requests are queued by submit() and executed in FIFO order by run(), which must be executed by the worker thread,
+ * for example:
+ *
+ *     distortos::devices::AsynchronousBlockDevice asynchronousBlockDevice {blockDevice};
+ *     auto worker = distortos::makeAndStartStaticThread<1024>(priority, &AsynchronousBlockDevice::run,
+ *             &asynchronousBlockDevice);
+ *
+ * Each request is executed with synchronous functions of associated block device, so the submitting thread may do
+ * other work (e.g. fill another buffer) while the data is transferred. Associated block device must be opened before
+ * the first request is submitted and it must not be closed while any request is pending.
+ *
+ * \ingroup devices
+ */
+
+class AsynchronousBlockDevice
+{
+public:
+
+	/**
+	 * \brief AsynchronousBlockDevice's constructor
+	 *
+	 * \param [in] blockDevice is a reference to associated block device
+	 */
+
+	constexpr explicit AsynchronousBlockDevice(BlockDevice& blockDevice) :
+			requests_{},
+			semaphore_{0},
+			blockDevice_{blockDevice},
+			stopRequested_{}
+	{
+
+	}
+
+	/**
+	 * \brief AsynchronousBlockDevice's destructor
+	 *
+	 * \pre No request is pending.
+	 */
+
+	~AsynchronousBlockDevice();
+
+	/**
+	 * \return reference to associated block device
+	 */
+
+	BlockDevice& getBlockDevice() const
+	{
+		return blockDevice_;
+	}
+
+	/**
+	 * \brief Executes submitted requests.
+	 *
+	 * This function should be executed by the worker thread. It returns when stop() is called and all requests
+	 * submitted before that call are completed.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 */
+
+	void run();
+
+	/**
+	 * \brief Requests run() to return after completing all requests submitted so far.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int stop();
+
+	/**
+	 * \brief Submits request for execution.
+	 *
+	 * When the request is completed, its callback (if any) is executed by the worker thread and then any thread
+	 * waiting in BlockDeviceRequest::wait() is unblocked. The callback may submit the same request again, in which case
+	 * waiting threads are unblocked when the resubmitted request is completed.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \pre \a request is prepared and either not pending or this function is called from its callback.
+	 *
+	 * \param [in] request is a reference to submitted request, it must not be destroyed before it is completed
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int submit(BlockDeviceRequest& request);
+
+	AsynchronousBlockDevice(const AsynchronousBlockDevice&) = delete;
+	AsynchronousBlockDevice& operator=(const AsynchronousBlockDevice&) = delete;
+
+private:
+
+	/**
+	 * \brief Executes one request with synchronous functions of associated block device.
+	 *
+	 * \param [in] request is a reference to executed request
+	 *
+	 * \return 0 on success, error code returned by BlockDevice's function otherwise
+	 */
+
+	int execute(const BlockDeviceRequest& request) const;
+
+	/// list of pending requests
+	estd::IntrusiveList<BlockDeviceRequest, &BlockDeviceRequest::node_> requests_;
+
+	/// semaphore with the number of submitted requests and stop requests
+	Semaphore semaphore_;
+
+	/// reference to associated block device
+	BlockDevice& blockDevice_;
+
+	/// true if run() should return after completing all requests submitted so far, false otherwise
+	bool stopRequested_;
+};
+
+}	// namespace devices
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DEVICES_MEMORY_ASYNCHRONOUSBLOCKDEVICE_HPP_
@@ -12,6 +12,10 @@
 #ifndef INCLUDE_DISTORTOS_DEVICES_MEMORY_BLOCKDEVICE_HPP_
 #define INCLUDE_DISTORTOS_DEVICES_MEMORY_BLOCKDEVICE_HPP_
 
+#include "distortos/devices/memory/BlockDeviceSegments.hpp"
+
+#include <mutex>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -122,6 +126,39 @@ public:
 
 	virtual int read(uint64_t address, void* buffer, size_t size) = 0;
 
+	/**
+	 * \brief Reads data from a device into multiple buffers.
+	 *
+	 * Data from consecutive addresses is read into consecutive segments. Default implementation calls read() for each
+	 * segment, derived classes may override it to read all segments with one transaction.
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and all \a segments are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of data that will be read, must be a multiple of block size
+	 * \param [in] segments is the range of segments into which the data will be read, size of each segment must be a
+	 * multiple of block size
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	virtual int readScatter(uint64_t address, const ReadSegmentsRange segments)
+	{
+		const std::lock_guard<BlockDevice> lockGuard {*this};
+
+		for (auto& segment : segments)
+		{
+			const auto ret = read(address, segment.buffer, segment.size);
+			if (ret != 0)
+				return ret;
+
+			address += segment.size;
+		}
+
+		return {};
+	}
+
 	/**
 	 * \brief Synchronizes state of a device, ensuring all cached writes are finished.
 	 *
@@ -160,6 +197,39 @@ public:
 
 	virtual int write(uint64_t address, const void* buffer, size_t size) = 0;
 
+	/**
+	 * \brief Writes data from multiple buffers to a device.
+	 *
+	 * Consecutive segments are written to consecutive addresses. Default implementation calls write() for each segment,
+	 * derived classes may override it to write all segments with one transaction.
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and all \a segments are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of data that will be written, must be a multiple of block size
+	 * \param [in] segments is the range of segments with data that will be written, size of each segment must be a
+	 * multiple of block size
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	virtual int writeGather(uint64_t address, const WriteSegmentsRange segments)
+	{
+		const std::lock_guard<BlockDevice> lockGuard {*this};
+
+		for (auto& segment : segments)
+		{
+			const auto ret = write(address, segment.buffer, segment.size);
+			if (ret != 0)
+				return ret;
+
+			address += segment.size;
+		}
+
+		return {};
+	}
+
 	BlockDevice() = default;
 	BlockDevice(const BlockDevice&) = delete;
 	BlockDevice& operator=(const BlockDevice&) = delete;
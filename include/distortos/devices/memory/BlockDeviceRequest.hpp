@@ -0,0 +1,297 @@
+/**
+ * \file
+ * \brief BlockDeviceRequest class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DEVICES_MEMORY_BLOCKDEVICEREQUEST_HPP_
+#define INCLUDE_DISTORTOS_DEVICES_MEMORY_BLOCKDEVICEREQUEST_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include "estd/IntrusiveList.hpp"
+
+#include <cassert>
+
+namespace distortos
+{
+
+namespace devices
+{
+
+/**
+ * \brief BlockDeviceRequest class is a descriptor of asynchronous operation on a block device.
+ *
+ * Request is prepared with one of prepare...() functions and then submitted with AsynchronousBlockDevice::submit().
+ * Completion of the request may be detected with a callback (which is executed by the thread which executes requests)
+ * or by waiting for the request with wait(). The object may be reused when it is no longer pending. The request is
+ * still pending while its callback is executed, but the callback may prepare and submit the same request again - in
+ * that case its previous completion is consumed by the callback and wait() returns when the resubmitted request is
+ * completed.
+ *
+ * \ingroup devices
+ */
+
+class BlockDeviceRequest
+{
+	friend class AsynchronousBlockDevice;
+
+public:
+
+	/// type of function called when the request is completed
+	using Callback = void(BlockDeviceRequest& request);
+
+	/// type of request
+	enum class Type : uint8_t
+	{
+		/// BlockDevice::erase()
+		erase,
+		/// BlockDevice::read()
+		read,
+		/// BlockDevice::synchronize()
+		synchronize,
+		/// BlockDevice::write()
+		write,
+	};
+
+	/**
+	 * \brief BlockDeviceRequest's constructor
+	 *
+	 * \param [in] callback is a pointer to function called when the request is completed, nullptr to disable,
+	 * default - nullptr
+	 * \param [in] context is a pointer to user's data associated with the request, default - nullptr
+	 */
+
+	constexpr explicit BlockDeviceRequest(Callback* const callback = {}, void* const context = {}) :
+			node_{},
+			semaphore_{0, 1},
+			address_{},
+			size_{},
+			buffer_{},
+			callback_{callback},
+			context_{context},
+			ret_{},
+			completing_{},
+			pending_{},
+			type_{}
+	{
+
+	}
+
+	/**
+	 * \brief BlockDeviceRequest's destructor
+	 *
+	 * \pre Request is not pending.
+	 */
+
+	~BlockDeviceRequest()
+	{
+		assert(pending_ == false);
+	}
+
+	/**
+	 * \return address of request
+	 */
+
+	uint64_t getAddress() const
+	{
+		return address_;
+	}
+
+	/**
+	 * \return pointer to buffer of request, nullptr for erase and synchronize requests
+	 */
+
+	void* getBuffer() const
+	{
+		return buffer_;
+	}
+
+	/**
+	 * \return pointer to user's data associated with the request
+	 */
+
+	void* getContext() const
+	{
+		return context_;
+	}
+
+	/**
+	 * \return result of completed request - 0 on success, error code returned by BlockDevice's function otherwise
+	 */
+
+	int getResult() const
+	{
+		return ret_;
+	}
+
+	/**
+	 * \return size of request, bytes
+	 */
+
+	uint64_t getSize() const
+	{
+		return size_;
+	}
+
+	/**
+	 * \return type of request
+	 */
+
+	Type getType() const
+	{
+		return type_;
+	}
+
+	/**
+	 * \return true if the request was submitted and is not completed yet (this includes execution of its callback),
+	 * false otherwise
+	 */
+
+	bool isPending() const
+	{
+		return pending_;
+	}
+
+	/**
+	 * \brief Prepares erase request.
+	 *
+	 * \pre Request is not pending or this function is called from request's callback.
+	 *
+	 * \param [in] address is the address of range that will be erased, must be a multiple of block size
+	 * \param [in] size is the size of erased range, bytes, must be a multiple of block size
+	 */
+
+	void prepareErase(const uint64_t address, const uint64_t size)
+	{
+		prepare(Type::erase, address, nullptr, size);
+	}
+
+	/**
+	 * \brief Prepares read request.
+	 *
+	 * \pre Request is not pending or this function is called from request's callback.
+	 *
+	 * \param [in] address is the address of data that will be read, must be a multiple of block size
+	 * \param [out] buffer is the buffer into which the data will be read, must be valid until the request is completed
+	 * \param [in] size is the size of \a buffer, bytes, must be a multiple of block size
+	 */
+
+	void prepareRead(const uint64_t address, void* const buffer, const size_t size)
+	{
+		prepare(Type::read, address, buffer, size);
+	}
+
+	/**
+	 * \brief Prepares synchronize request.
+	 *
+	 * \pre Request is not pending or this function is called from request's callback.
+	 */
+
+	void prepareSynchronize()
+	{
+		prepare(Type::synchronize, {}, nullptr, {});
+	}
+
+	/**
+	 * \brief Prepares write request.
+	 *
+	 * \pre Request is not pending or this function is called from request's callback.
+	 *
+	 * \param [in] address is the address of data that will be written, must be a multiple of block size
+	 * \param [in] buffer is the buffer with data that will be written, must be valid until the request is completed
+	 * \param [in] size is the size of \a buffer, bytes, must be a multiple of block size
+	 */
+
+	void prepareWrite(const uint64_t address, const void* const buffer, const size_t size)
+	{
+		prepare(Type::write, address, const_cast<void*>(buffer), size);
+	}
+
+	/**
+	 * \brief Waits for completion of the request.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Request was submitted.
+	 *
+	 * \return result of completed request - 0 on success, error code returned by BlockDevice's function otherwise
+	 */
+
+	int wait()
+	{
+		while (semaphore_.wait() != 0);
+		return ret_;
+	}
+
+	BlockDeviceRequest(const BlockDeviceRequest&) = delete;
+	BlockDeviceRequest& operator=(const BlockDeviceRequest&) = delete;
+
+private:
+
+	/**
+	 * \brief Prepares request.
+	 *
+	 * \pre Request is not pending or this function is called from request's callback.
+	 *
+	 * \param [in] type is the type of request
+	 * \param [in] address is the address of request
+	 * \param [in] buffer is a pointer to buffer of request
+	 * \param [in] size is the size of request, bytes
+	 */
+
+	void prepare(const Type type, const uint64_t address, void* const buffer, const uint64_t size)
+	{
+		assert(pending_ == false || completing_ == true);
+
+		address_ = address;
+		size_ = size;
+		buffer_ = buffer;
+		ret_ = {};
+		type_ = type;
+	}
+
+	/// node for intrusive list of pending requests
+	estd::IntrusiveListNode node_;
+
+	/// semaphore posted when the request is completed
+	Semaphore semaphore_;
+
+	/// address of request
+	uint64_t address_;
+
+	/// size of request, bytes
+	uint64_t size_;
+
+	/// pointer to buffer of request
+	void* buffer_;
+
+	/// pointer to function called when the request is completed, nullptr if disabled
+	Callback* callback_;
+
+	/// pointer to user's data associated with the request
+	void* context_;
+
+	/// result of completed request
+	int ret_;
+
+	/// true if callback of the request is being executed, false otherwise
+	bool completing_;
+
+	/// true if the request was submitted and is not completed yet, false otherwise
+	volatile bool pending_;
+
+	/// type of request
+	Type type_;
+};
+
+}	// namespace devices
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DEVICES_MEMORY_BLOCKDEVICEREQUEST_HPP_
@@ -0,0 +1,73 @@
+/**
+ * \file
+ * \brief ReadSegment and WriteSegment structs header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DEVICES_MEMORY_BLOCKDEVICESEGMENTS_HPP_
+#define INCLUDE_DISTORTOS_DEVICES_MEMORY_BLOCKDEVICESEGMENTS_HPP_
+
+#include "estd/ContiguousRange.hpp"
+
+namespace distortos
+{
+
+namespace devices
+{
+
+/**
+ * \brief ReadSegment struct is one contiguous buffer of scattered read.
+ *
+ * \ingroup devices
+ */
+
+struct ReadSegment
+{
+	/// buffer into which the data will be read
+	void* buffer;
+
+	/// size of \a buffer, bytes
+	size_t size;
+};
+
+/**
+ * \brief WriteSegment struct is one contiguous buffer of gathered write.
+ *
+ * \ingroup devices
+ */
+
+struct WriteSegment
+{
+	/// buffer with data that will be written
+	const void* buffer;
+
+	/// size of \a buffer, bytes
+	size_t size;
+};
+
+/**
+ * \brief ReadSegmentsRange is an alias for ContiguousRange of ReadSegment elements.
+ *
+ * \ingroup devices
+ */
+
+using ReadSegmentsRange = estd::ContiguousRange<const ReadSegment>;
+
+/**
+ * \brief WriteSegmentsRange is an alias for ContiguousRange of WriteSegment elements.
+ *
+ * \ingroup devices
+ */
+
+using WriteSegmentsRange = estd::ContiguousRange<const WriteSegment>;
+
+}	// namespace devices
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DEVICES_MEMORY_BLOCKDEVICESEGMENTS_HPP_
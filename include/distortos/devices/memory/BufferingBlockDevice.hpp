@@ -220,6 +220,30 @@ public:
 
 	int write(uint64_t address, const void* buffer, size_t size) override;
 
+	/**
+	 * \brief Writes data from multiple buffers to a device.
+	 *
+	 * If total size of all segments is less than the size of write buffer, the segments are collected in write buffer
+	 * with write(). Otherwise the write buffer is flushed (only if it overlaps written range) and the segments are
+	 * passed to associated block device without copying.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and all \a segments are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of data that will be written, must be a multiple of block size
+	 * \param [in] segments is the range of segments with data that will be written, size of each segment must be a
+	 * multiple of block size
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by flushWriteBuffer();
+	 * - error codes returned by BlockDevice::writeGather() of associated block device;
+	 */
+
+	int writeGather(uint64_t address, WriteSegmentsRange segments) override;
+
 private:
 
 	/**
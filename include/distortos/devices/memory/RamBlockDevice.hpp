@@ -0,0 +1,260 @@
+/**
+ * \file
+ * \brief RamBlockDevice class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DEVICES_MEMORY_RAMBLOCKDEVICE_HPP_
+#define INCLUDE_DISTORTOS_DEVICES_MEMORY_RAMBLOCKDEVICE_HPP_
+
+#include "distortos/devices/memory/BlockDevice.hpp"
+
+#include "distortos/Mutex.hpp"
+
+namespace distortos
+{
+
+namespace devices
+{
+
+/**
+ * \brief RamBlockDevice class is a block device which stores its contents in a provided memory buffer.
+ *
+ * Such device may be used as a RAM disk or - when the buffer is a file mapped to memory - to test and benchmark file
+ * systems on a host. Erased blocks are filled with 0xff.
+ *
+ * \ingroup devices
+ */
+
+class RamBlockDevice : public BlockDevice
+{
+public:
+
+	/// statistics of operations executed by the device since it was constructed or since statistics were reset
+	struct Statistics
+	{
+		/// number of bytes erased
+		uint64_t erasedBytes;
+
+		/// number of executed erase operations
+		uint64_t erases;
+
+		/// number of bytes read
+		uint64_t readBytes;
+
+		/// number of executed read operations
+		uint64_t reads;
+
+		/// number of bytes written
+		uint64_t writtenBytes;
+
+		/// number of executed write operations
+		uint64_t writes;
+	};
+
+	/**
+	 * \brief RamBlockDevice's constructor
+	 *
+	 * \param [in] buffer is a pointer to buffer with contents of device, must be valid
+	 * \param [in] size is the size of \a buffer, bytes, must be a multiple of \a blockSize
+	 * \param [in] blockSize is the block size, bytes, must be a power of 2, default - 512
+	 */
+
+	constexpr RamBlockDevice(void* const buffer, const size_t size, const size_t blockSize = 512) :
+			mutex_{Mutex::Type::recursive, Mutex::Protocol::priorityInheritance},
+			statistics_{},
+			buffer_{static_cast<uint8_t*>(buffer)},
+			blockSize_{blockSize},
+			size_{size},
+			openCount_{}
+	{
+
+	}
+
+	/**
+	 * \brief RamBlockDevice's destructor
+	 *
+	 * \pre Device is closed.
+	 */
+
+	~RamBlockDevice() override;
+
+	/**
+	 * \brief Closes device.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int close() override;
+
+	/**
+	 * \brief Erases blocks on a device.
+	 *
+	 * Erased blocks are filled with 0xff.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and \a size are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of range that will be erased, must be a multiple of block size
+	 * \param [in] size is the size of erased range, bytes, must be a multiple of block size
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int erase(uint64_t address, uint64_t size) override;
+
+	/**
+	 * \return block size, bytes
+	 */
+
+	size_t getBlockSize() const override;
+
+	/**
+	 * \return size of block device, bytes
+	 */
+
+	uint64_t getSize() const override;
+
+	/**
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return statistics of operations executed by the device
+	 */
+
+	Statistics getStatistics();
+
+	/**
+	 * \brief Locks the device for exclusive use by current thread.
+	 *
+	 * When the object is locked, any call to any member function from other thread will be blocked until the object is
+	 * unlocked. Locking is optional, but may be useful when more than one transaction must be done atomically.
+	 *
+	 * \note Locks are recursive.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre The number of recursive locks of device is less than 65535.
+	 *
+	 * \post Device is locked.
+	 */
+
+	void lock() override;
+
+	/**
+	 * \brief Opens device.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre The number of times the device is opened is less than 255.
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int open() override;
+
+	/**
+	 * \brief Reads data from a device.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and \a buffer and \a size are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of data that will be read, must be a multiple of block size
+	 * \param [out] buffer is the buffer into which the data will be read, must be valid
+	 * \param [in] size is the size of \a buffer, bytes, must be a multiple of block size
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int read(uint64_t address, void* buffer, size_t size) override;
+
+	/**
+	 * \brief Resets statistics of operations executed by the device.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 */
+
+	void resetStatistics();
+
+	/**
+	 * \brief Synchronizes state of a device, ensuring all cached writes are finished.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 *
+	 * \return always 0
+	 */
+
+	int synchronize() override;
+
+	/**
+	 * \brief Unlocks the device which was previously locked by current thread.
+	 *
+	 * \note Locks are recursive.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre This function is called by the thread that locked the device.
+	 */
+
+	void unlock() override;
+
+	/**
+	 * \brief Writes data to a device.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and \a buffer and \a size are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of data that will be written, must be a multiple of block size
+	 * \param [in] buffer is the buffer with data that will be written, must be valid
+	 * \param [in] size is the size of \a buffer, bytes, must be a multiple of block size
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int write(uint64_t address, const void* buffer, size_t size) override;
+
+private:
+
+	/// mutex used to serialize access to this object
+	Mutex mutex_;
+
+	/// statistics of operations executed by the device
+	Statistics statistics_;
+
+	/// pointer to buffer with contents of device
+	uint8_t* buffer_;
+
+	/// block size, bytes
+	size_t blockSize_;
+
+	/// size of device, bytes
+	size_t size_;
+
+	/// number of times this device was opened but not yet closed
+	uint8_t openCount_;
+};
+
+}	// namespace devices
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DEVICES_MEMORY_RAMBLOCKDEVICE_HPP_
@@ -0,0 +1,321 @@
+/**
+ * \file
+ * \brief RamMemoryTechnologyDevice class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DEVICES_MEMORY_RAMMEMORYTECHNOLOGYDEVICE_HPP_
+#define INCLUDE_DISTORTOS_DEVICES_MEMORY_RAMMEMORYTECHNOLOGYDEVICE_HPP_
+
+#include "distortos/devices/memory/MemoryTechnologyDevice.hpp"
+
+#include "distortos/Mutex.hpp"
+
+#include <chrono>
+
+namespace distortos
+{
+
+namespace devices
+{
+
+/**
+ * \brief RamMemoryTechnologyDevice class is a memory technology device which emulates NOR flash memory in a provided
+ * memory buffer.
+ *
+ * Erased blocks are filled with 0xff and programming can only clear bits, exactly like in NOR flash memory, so data
+ * programmed over a range which was not erased is corrupted in the same way as in real device. The device does not
+ * actually wait, but it accumulates the time that real device would spend on each operation and can count erase
+ * cycles of each erase block, so it may be used to test and benchmark file systems on a host.
+ *
+ * \ingroup devices
+ */
+
+class RamMemoryTechnologyDevice : public MemoryTechnologyDevice
+{
+public:
+
+	/// statistics of operations executed by the device since it was constructed or since statistics were reset
+	struct Statistics
+	{
+		/// total time that real device would spend on executed operations
+		std::chrono::nanoseconds busyTime;
+
+		/// number of erased blocks
+		uint64_t erasedBlocks;
+
+		/// number of executed erase operations
+		uint64_t erases;
+
+		/// number of bytes programmed
+		uint64_t programmedBytes;
+
+		/// number of executed program operations
+		uint64_t programs;
+
+		/// number of bytes read
+		uint64_t readBytes;
+
+		/// number of executed read operations
+		uint64_t reads;
+	};
+
+	/// timings of emulated device
+	struct Timings
+	{
+		/// time of erasing one erase block
+		std::chrono::nanoseconds eraseTime;
+
+		/// time of programming one program block
+		std::chrono::nanoseconds programTime;
+
+		/// time of reading one read block
+		std::chrono::nanoseconds readTime;
+	};
+
+	/**
+	 * \brief RamMemoryTechnologyDevice's constructor
+	 *
+	 * \param [in] buffer is a pointer to buffer with contents of device, must be valid
+	 * \param [in] size is the size of \a buffer, bytes, must be a multiple of \a eraseBlockSize
+	 * \param [in] readBlockSize is the read block size, bytes, must be a power of 2
+	 * \param [in] programBlockSize is the program block size, bytes, must be a power of 2
+	 * \param [in] eraseBlockSize is the erase block size, bytes, must be a power of 2 and a multiple of both
+	 * \a readBlockSize and \a programBlockSize
+	 * \param [in] timings are the timings of emulated device, default - all operations take no time
+	 * \param [in] eraseCounters is a pointer to array in which the number of erase cycles of each erase block will be
+	 * counted, it must have `size / eraseBlockSize` elements, nullptr to disable counting, default - nullptr
+	 */
+
+	constexpr RamMemoryTechnologyDevice(void* const buffer, const size_t size, const size_t readBlockSize,
+			const size_t programBlockSize, const size_t eraseBlockSize, const Timings& timings = {},
+			uint32_t* const eraseCounters = {}) :
+					mutex_{Mutex::Type::recursive, Mutex::Protocol::priorityInheritance},
+					statistics_{},
+					timings_{timings},
+					buffer_{static_cast<uint8_t*>(buffer)},
+					eraseCounters_{eraseCounters},
+					eraseBlockSize_{eraseBlockSize},
+					programBlockSize_{programBlockSize},
+					readBlockSize_{readBlockSize},
+					size_{size},
+					openCount_{}
+	{
+
+	}
+
+	/**
+	 * \brief RamMemoryTechnologyDevice's destructor
+	 *
+	 * \pre Device is closed.
+	 */
+
+	~RamMemoryTechnologyDevice() override;
+
+	/**
+	 * \brief Closes device.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int close() override;
+
+	/**
+	 * \brief Erases blocks on a device.
+	 *
+	 * Erased blocks are filled with 0xff.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and \a size are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of range that will be erased, must be a multiple of erase block size
+	 * \param [in] size is the size of erased range, bytes, must be a multiple of erase block size
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int erase(uint64_t address, uint64_t size) override;
+
+	/**
+	 * \return erase block size, bytes
+	 */
+
+	size_t getEraseBlockSize() const override;
+
+	/**
+	 * \return program block size, bytes
+	 */
+
+	size_t getProgramBlockSize() const override;
+
+	/**
+	 * \return read block size, bytes
+	 */
+
+	size_t getReadBlockSize() const override;
+
+	/**
+	 * \return size of device, bytes
+	 */
+
+	uint64_t getSize() const override;
+
+	/**
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return statistics of operations executed by the device
+	 */
+
+	Statistics getStatistics();
+
+	/**
+	 * \brief Locks the device for exclusive use by current thread.
+	 *
+	 * When the object is locked, any call to any member function from other thread will be blocked until the object is
+	 * unlocked. Locking is optional, but may be useful when more than one transaction must be done atomically.
+	 *
+	 * \note Locks are recursive.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre The number of recursive locks of device is less than 65535.
+	 *
+	 * \post Device is locked.
+	 */
+
+	void lock() override;
+
+	/**
+	 * \brief Opens device.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre The number of times the device is opened is less than 255.
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int open() override;
+
+	/**
+	 * \brief Programs data to a device.
+	 *
+	 * Programming can only clear bits, so each programmed byte is a bitwise AND of previous contents and new data.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and \a buffer and \a size are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of data that will be programmed, must be a multiple of program block size
+	 * \param [in] buffer is the buffer with data that will be programmed, must be valid
+	 * \param [in] size is the size of \a buffer, bytes, must be a multiple of program block size
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int program(uint64_t address, const void* buffer, size_t size) override;
+
+	/**
+	 * \brief Reads data from a device.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and \a buffer and \a size are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of data that will be read, must be a multiple of read block size
+	 * \param [out] buffer is the buffer into which the data will be read, must be valid
+	 * \param [in] size is the size of \a buffer, bytes, must be a multiple of read block size
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int read(uint64_t address, void* buffer, size_t size) override;
+
+	/**
+	 * \brief Resets statistics of operations executed by the device.
+	 *
+	 * Erase counters are not reset.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 */
+
+	void resetStatistics();
+
+	/**
+	 * \brief Synchronizes state of a device, ensuring all cached writes are finished.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 *
+	 * \return always 0
+	 */
+
+	int synchronize() override;
+
+	/**
+	 * \brief Unlocks the device which was previously locked by current thread.
+	 *
+	 * \note Locks are recursive.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre This function is called by the thread that locked the device.
+	 */
+
+	void unlock() override;
+
+private:
+
+	/// mutex used to serialize access to this object
+	Mutex mutex_;
+
+	/// statistics of operations executed by the device
+	Statistics statistics_;
+
+	/// timings of emulated device
+	Timings timings_;
+
+	/// pointer to buffer with contents of device
+	uint8_t* buffer_;
+
+	/// pointer to array with erase counters of each erase block, nullptr if counting is disabled
+	uint32_t* eraseCounters_;
+
+	/// erase block size, bytes
+	size_t eraseBlockSize_;
+
+	/// program block size, bytes
+	size_t programBlockSize_;
+
+	/// read block size, bytes
+	size_t readBlockSize_;
+
+	/// size of device, bytes
+	size_t size_;
+
+	/// number of times this device was opened but not yet closed
+	uint8_t openCount_;
+};
+
+}	// namespace devices
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DEVICES_MEMORY_RAMMEMORYTECHNOLOGYDEVICE_HPP_
@@ -218,15 +218,33 @@ public:
 	 * \param [in] size is the size of \a buffer, bytes, must be a multiple of block size
 	 *
 	 * \return 0 on success, error code otherwise:
-	 * - EIO - error during communication with SD card;
-	 * - error codes returned by executeAcmd23();
-	 * - error codes returned by executeCmd12();
-	 * - error codes returned by executeCmd24();
-	 * - error codes returned by executeCmd25();
+	 * - error codes returned by writeImplementation();
 	 */
 
 	int write(uint64_t address, const void* buffer, size_t size) override;
 
+	/**
+	 * \brief Writes data from multiple buffers to SD card.
+	 *
+	 * All segments are written with one multi block write command, so the data doesn't have to be copied to one
+	 * contiguous buffer.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre Device is opened.
+	 * \pre \a address and all \a segments are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of data that will be written, must be a multiple of block size
+	 * \param [in] segments is the range of segments with data that will be written, size of each segment must be a
+	 * non-zero multiple of block size
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by writeImplementation();
+	 */
+
+	int writeGather(uint64_t address, WriteSegmentsRange segments) override;
+
 private:
 
 	/**
@@ -255,6 +273,27 @@ private:
 
 	int initialize();
 
+	/**
+	 * \brief Implementation of write() and writeGather().
+	 *
+	 * \pre Device is opened and locked.
+	 * \pre \a address and \a writeTransfer are valid.
+	 * \pre Selected range is within address space of device.
+	 *
+	 * \param [in] address is the address of data that will be written, must be a multiple of block size
+	 * \param [in] writeTransfer is the write transfer with data that will be written, its size must be a multiple of
+	 * block size
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EIO - error during communication with SD card;
+	 * - error codes returned by executeAcmd23();
+	 * - error codes returned by executeCmd12();
+	 * - error codes returned by executeCmd24();
+	 * - error codes returned by executeCmd25();
+	 */
+
+	int writeImplementation(uint64_t address, const SdMmcCardLowLevel::WriteTransfer& writeTransfer);
+
 	/// current deadline of waiting while card is busy
 	TickClock::time_point busyDeadline_;
 
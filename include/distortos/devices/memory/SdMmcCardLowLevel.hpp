@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_DEVICES_MEMORY_SDMMCCARDLOWLEVEL_HPP_
 #define INCLUDE_DISTORTOS_DEVICES_MEMORY_SDMMCCARDLOWLEVEL_HPP_
 
+#include "distortos/devices/memory/BlockDeviceSegments.hpp"
+
 #include "estd/ContiguousRange.hpp"
 
 namespace distortos
@@ -147,6 +149,7 @@ public:
 
 		constexpr Transfer() :
 				readBuffer_{},
+				writeSegments_{},
 				size_{},
 				blockSize_{},
 				timeoutMs_{},
@@ -169,6 +172,7 @@ public:
 		constexpr Transfer(void* const readBuffer, const size_t size, const size_t blockSize,
 				const uint16_t timeoutMs) :
 						readBuffer_{readBuffer},
+						writeSegments_{},
 						size_{size},
 						blockSize_{blockSize},
 						timeoutMs_{timeoutMs},
@@ -191,6 +195,31 @@ public:
 		constexpr Transfer(const void* const writeBuffer, const size_t size, const size_t blockSize,
 				const uint16_t timeoutMs) :
 						writeBuffer_{writeBuffer},
+						writeSegments_{},
+						size_{size},
+						blockSize_{blockSize},
+						timeoutMs_{timeoutMs},
+						writeTransfer_{true}
+		{
+
+		}
+
+		/**
+		 * \brief Transfer's constructor
+		 *
+		 * Used when gathered write transfer is associated with transaction.
+		 *
+		 * \param [in] writeSegments is the range of segments with data that will be written, must not be empty, size of
+		 * each segment must be a multiple of block size
+		 * \param [in] size is the total size of all \a writeSegments, bytes
+		 * \param [in] blockSize is the block size, bytes
+		 * \param [in] timeoutMs is the timeout of write transfer, milliseconds
+		 */
+
+		constexpr Transfer(const WriteSegmentsRange writeSegments, const size_t size, const size_t blockSize,
+				const uint16_t timeoutMs) :
+						writeBuffer_{writeSegments.begin()->buffer},
+						writeSegments_{writeSegments},
 						size_{size},
 						blockSize_{blockSize},
 						timeoutMs_{timeoutMs},
@@ -236,7 +265,8 @@ public:
 		}
 
 		/**
-		 * \return buffer with data that will be written, valid only if isWriteTransfer() returns true
+		 * \return buffer with data that will be written, valid only if isWriteTransfer() returns true; for gathered
+		 * write transfer this is the buffer of first segment
 		 */
 
 		const void* getWriteBuffer() const
@@ -244,6 +274,15 @@ public:
 			return writeBuffer_;
 		}
 
+		/**
+		 * \return range of segments with data that will be written, empty if this is not a gathered write transfer
+		 */
+
+		WriteSegmentsRange getWriteSegments() const
+		{
+			return writeSegments_;
+		}
+
 		/**
 		 * \return false if this is a read transfer, true if this is a write transfer
 		 */
@@ -264,7 +303,11 @@ public:
 			const void* writeBuffer_;
 		};
 
-		/// size of \a readBuffer_ or \a writeBuffer_, bytes
+		/// range of segments with data that will be written, empty if this is not a gathered write transfer
+		WriteSegmentsRange writeSegments_;
+
+		/// size of \a readBuffer_ or \a writeBuffer_ (total size of \a writeSegments_ for gathered write transfer),
+		/// bytes
 		size_t size_;
 
 		/// block size, bytes
@@ -316,6 +359,25 @@ public:
 		{
 
 		}
+
+		/**
+		 * \brief WriteTransfer's constructor
+		 *
+		 * Used for gathered write transfer.
+		 *
+		 * \param [in] writeSegments is the range of segments with data that will be written, must not be empty, size of
+		 * each segment must be a multiple of block size
+		 * \param [in] size is the total size of all \a writeSegments, bytes
+		 * \param [in] blockSize is the block size, bytes
+		 * \param [in] timeoutMs is the timeout of write transfer, milliseconds
+		 */
+
+		constexpr WriteTransfer(const WriteSegmentsRange writeSegments, const size_t size, const size_t blockSize,
+				const uint16_t timeoutMs) :
+						Transfer{writeSegments, size, blockSize, timeoutMs}
+		{
+
+		}
 	};
 
 	/// maximum allowed command
@@ -16,7 +16,8 @@
 
 #if DISTORTOS_FILESYSTEMS_STANDARD_LIBRARY_INTEGRATION_ENABLE == 1
 
-#include "distortos/Mutex.hpp"
+#include <cstddef>
+#include <cstdint>
 
 namespace distortos
 {
@@ -85,6 +86,15 @@ public:
 		return name_;
 	}
 
+	/**
+	 * \return length of the name of the mount point
+	 */
+
+	size_t getNameLength() const
+	{
+		return nameLength_;
+	}
+
 	/**
 	 * \return number of references to this object
 	 */
@@ -111,16 +121,17 @@ public:
 
 private:
 
-	/// mutex for serializing access to this object
-	Mutex mutex_;
-
 	/// reference to file system managed by this mount point
 	FileSystem& fileSystem_;
 
 	/// name of the mountpoint
 	char name_[maxNameLength + 1];
 
-	/// number of references to this object
+	/// length of the name of the mountpoint
+	uint8_t nameLength_;
+
+	/// number of references to this object, modified with interrupt masking, so neither copying of
+	/// MountPointSharedPointer nor lookup of mount points needs any mutex
 	uint8_t referenceCount_;
 };
 
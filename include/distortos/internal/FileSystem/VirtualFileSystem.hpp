@@ -18,6 +18,10 @@
 
 #include "distortos/internal/FileSystem/MountPointSharedPointer.hpp"
 
+#include "estd/IntrusiveList.hpp"
+
+#include <sys/types.h>
+
 struct stat;
 struct statvfs;
 
@@ -40,8 +44,7 @@ public:
 	 */
 
 	constexpr VirtualFileSystem() :
-			mountPoints_{},
-			mutex_{Mutex::Type::recursive, Mutex::Protocol::priorityInheritance}
+			mountPoints_{}
 	{
 
 	}
@@ -242,11 +245,8 @@ private:
 
 	MountPointSharedPointer getMountPointSharedPointer(const char* name, size_t length);
 
-	/// list of mount points
+	/// list of mount points, modified and searched with interrupt masking
 	estd::IntrusiveList<MountPointListNode, &MountPointListNode::node> mountPoints_;
-
-	/// mutex for serializing access to the object
-	distortos::Mutex mutex_;
 };
 
 }	// namespace internal
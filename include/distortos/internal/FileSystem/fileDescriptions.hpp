@@ -33,7 +33,7 @@ namespace internal
 +---------------------------------------------------------------------------------------------------------------------*/
 
 /// array of unique pointers to files
-extern std::array<std::unique_ptr<File>, 20> fileDescriptions;
+extern std::array<std::unique_ptr<File>, DISTORTOS_FILESYSTEMS_FILE_DESCRIPTORS_MAX> fileDescriptions;
 
 /// number of reserved elements in \a fileDescriptions
 extern uint8_t fileDescriptionsCount;
@@ -186,6 +186,73 @@ public:
 		return state_;
 	}
 
+	/**
+	 * \return pointer to ThreadGroupControlBlock with which this object is associated
+	 */
+
+	ThreadGroupControlBlock* getThreadGroupControlBlock() const
+	{
+		return threadGroupControlBlock_;
+	}
+
+#ifdef DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+
+	/**
+	 * \return true if the thread was declared to not use floating-point unit, false otherwise
+	 */
+
+	bool isFpuFree() const
+	{
+		return fpuFree_;
+	}
+
+#endif	// def DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+
+	/**
+	 * \brief Lowers boosted priority of the thread.
+	 *
+	 * This function should be called when boosted priority of one of the mutexes with enabled priority protocol owned
+	 * by this thread was lowered or when such mutex is no longer owned by this thread. If the previous boosted priority
+	 * of that mutex was lower than current boosted priority of this thread, then that mutex could not be the source of
+	 * boosting - in this case boosted priority of the thread doesn't change and the function returns immediately.
+	 * Otherwise boosted priority is recalculated with updateBoostedPriority(). When the length of the chain of
+	 * transitive priority inheritance is limited with DISTORTOS_PRIORITY_INHERITANCE_MAX_CHAIN_DEPTH, the shortcut is
+	 * not used - lowering which was not propagated may have left boosted priority of the thread too high, so it is
+	 * always recalculated.
+	 *
+	 * \param [in] previousBoostedPriority is the boosted priority of the mutex before it was lowered
+	 * \param [in] depth is the position of this thread in the chain of transitive priority inheritance, default - 0
+	 */
+
+	void lowerBoostedPriority(uint8_t previousBoostedPriority, uint8_t depth = {});
+
+	/**
+	 * \brief Raises boosted priority of the thread.
+	 *
+	 * This function should be called when boosted priority of one of the mutexes with enabled priority protocol owned
+	 * by this thread was raised (or when this thread became the owner of such mutex). New boosted priority of the
+	 * thread is the greater value of its current boosted priority and \a boostedPriority, so no traversal of owned
+	 * mutexes is required.
+	 *
+	 * \param [in] boostedPriority is the new boosted priority of the mutex
+	 * \param [in] depth is the position of this thread in the chain of transitive priority inheritance, default - 0
+	 */
+
+	void raiseBoostedPriority(uint8_t boostedPriority, uint8_t depth = {});
+
+#ifdef DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+
+	/**
+	 * \brief Declares that the thread doesn't use floating-point unit.
+	 */
+
+	void setFpuFree()
+	{
+		fpuFree_ = true;
+	}
+
+#endif	// def DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+
 	/**
 	 * \brief Sets the list that has this object.
 	 *
@@ -263,14 +330,14 @@ public:
 	/**
 	 * \brief Updates boosted priority of the thread.
 	 *
-	 * This function should be called after all operations involving this thread and a mutex with enabled priority
-	 * protocol.
+	 * Boosted priority is recalculated from scratch, using all mutexes with enabled priority protocol owned by this
+	 * thread. In most cases cheaper raiseBoostedPriority() or lowerBoostedPriority() should be used instead.
 	 *
-	 * \param [in] boostedPriority is the initial boosted priority, this should be effective priority of the thread that
-	 * is about to be blocked on a mutex owned by this thread, default - 0
+	 * \param [in] boostedPriority is the initial boosted priority, default - 0
+	 * \param [in] depth is the position of this thread in the chain of transitive priority inheritance, default - 0
 	 */
 
-	void updateBoostedPriority(uint8_t boostedPriority = {});
+	void updateBoostedPriority(uint8_t boostedPriority = {}, uint8_t depth = {});
 
 	ThreadControlBlock(const ThreadControlBlock&) = delete;
 	ThreadControlBlock(ThreadControlBlock&&) = default;
@@ -295,6 +362,19 @@ private:
 
 	void reposition(bool loweringBefore);
 
+	/**
+	 * \brief Sets boosted priority of the thread.
+	 *
+	 * If effective priority of the thread changes, the position in the thread list is adjusted and the change is
+	 * propagated to the owner of the mutex with priorityInheritance protocol that blocks this thread (if any), unless
+	 * the chain of transitive priority inheritance is longer than DISTORTOS_PRIORITY_INHERITANCE_MAX_CHAIN_DEPTH.
+	 *
+	 * \param [in] boostedPriority is the new boosted priority of the thread
+	 * \param [in] depth is the position of this thread in the chain of transitive priority inheritance
+	 */
+
+	void setBoostedPriority(uint8_t boostedPriority, uint8_t depth);
+
 	/// list of mutexes (mutex control blocks) with enabled priority protocol owned by this thread
 	MutexList ownedProtocolMutexList_;
 
@@ -337,6 +417,13 @@ private:
 
 	/// current state of object
 	ThreadState state_;
+
+#ifdef DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+
+	/// true if the thread was declared to not use floating-point unit, false otherwise
+	bool fpuFree_;
+
+#endif	// def DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
 };
 
 }	// namespace internal
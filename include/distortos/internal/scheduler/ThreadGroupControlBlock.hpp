@@ -45,6 +45,23 @@ public:
 
 	void add(ThreadControlBlock& threadControlBlock);
 
+	/**
+	 * \brief Executes provided functor for each ThreadControlBlock in this group.
+	 *
+	 * \attention This function must be called with interrupts masked.
+	 *
+	 * \tparam Functor is the type of functor, it should be callable with `const ThreadControlBlock&` argument
+	 *
+	 * \param [in] functor is the functor which will be executed
+	 */
+
+	template<typename Functor>
+	void forEach(Functor&& functor) const
+	{
+		for (const auto& threadControlBlock : threadList_)
+			functor(threadControlBlock);
+	}
+
 private:
 
 	/// intrusive list of threads (thread control blocks)
@@ -0,0 +1,45 @@
+/**
+ * \file
+ * \brief recordInterruptMaskingSection() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RECORDINTERRUPTMASKINGSECTION_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RECORDINTERRUPTMASKINGSECTION_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief Records single section with masked interrupts in interrupt masking statistics.
+ *
+ * \attention This function must be called with enabled interrupt masking, before the interrupts are unmasked.
+ *
+ * \param [in] maskingAddress is the address of code which masked interrupts
+ * \param [in] unmaskingAddress is the address of code which unmasks interrupts
+ * \param [in] duration is the duration of section, core clock cycles
+ */
+
+void recordInterruptMaskingSection(const void* maskingAddress, const void* unmaskingAddress, uint32_t duration);
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RECORDINTERRUPTMASKINGSECTION_HPP_
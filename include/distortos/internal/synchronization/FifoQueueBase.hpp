@@ -68,6 +68,15 @@ public:
 		return elementSize_;
 	}
 
+	/**
+	 * \return reference to semaphore with the number of elements available for popping
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return popSemaphore_;
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
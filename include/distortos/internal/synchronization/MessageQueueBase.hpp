@@ -153,6 +153,15 @@ public:
 		return popSemaphore_.getMaxValue();
 	}
 
+	/**
+	 * \return reference to semaphore with the number of elements available for popping
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return popSemaphore_;
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -158,6 +158,9 @@ public:
 
 private:
 
+	/// value in \a associationIndexes_ for signal numbers which have no association
+	constexpr static uint8_t noAssociation {UINT8_MAX};
+
 	/**
 	 * \brief Clears association for given signal number.
 	 *
@@ -190,6 +193,17 @@ private:
 		return reinterpret_cast<Association*>(storageUniquePointer_.get());
 	}
 
+	/**
+	 * \brief Looks up association for given signal number.
+	 *
+	 * \param [in] signalNumber is the signal for which the association will be searched, [0; 31]
+	 *
+	 * \return pointer to Association object for \a signalNumber, \a associationsEnd_ if there is no association for
+	 * this signal number
+	 */
+
+	Association* lookUpAssociation(uint8_t signalNumber) const;
+
 	/**
 	 * \brief Requests delivery of signals to associated thread.
 	 *
@@ -223,6 +237,10 @@ private:
 	/// pointer to "one past the last" element of range of Storage objects
 	Storage* storageEnd_;
 
+	/// indexes of Association objects (in <em>[associationsBegin_; associationsEnd_)</em> range) for each signal
+	/// number, noAssociation if there is no association for given signal number
+	uint8_t associationIndexes_[SignalSet::Bitset{}.size()];
+
 	/// true if signal delivery is pending, false otherwise
 	bool deliveryIsPending_;
 };
@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief deliverZeroLatencyNotifications() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_DELIVERZEROLATENCYNOTIFICATIONS_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_DELIVERZEROLATENCYNOTIFICATIONS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief Delivers all pending notifications sent with ZeroLatencyNotification::notify().
+ *
+ * Each notification is converted to Semaphore::post() of associated semaphore.
+ *
+ * \warning This function must be called only from the context switch handler, with kernel's interrupt masking enabled!
+ */
+
+void deliverZeroLatencyNotifications();
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_DELIVERZEROLATENCYNOTIFICATIONS_HPP_
@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief notifyQueueSet() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_NOTIFYQUEUESET_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_NOTIFYQUEUESET_HPP_
+
+namespace distortos
+{
+
+class QueueSet;
+
+namespace internal
+{
+
+/**
+ * \brief Notifies QueueSet that one of its members may have become ready.
+ *
+ * First of the threads waiting for the set (if any) is unblocked.
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \param [in] queueSet is a reference to notified QueueSet
+ */
+
+void notifyQueueSet(QueueSet& queueSet);
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_NOTIFYQUEUESET_HPP_
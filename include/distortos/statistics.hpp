@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,7 +12,12 @@
 #ifndef INCLUDE_DISTORTOS_STATISTICS_HPP_
 #define INCLUDE_DISTORTOS_STATISTICS_HPP_
 
-#include <cstdint>
+#include "distortos/distortosConfiguration.h"
+#include "distortos/ThreadIdentifier.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+#include <cstddef>
 
 namespace distortos
 {
@@ -23,12 +28,111 @@ namespace statistics
 /// \addtogroup statistics
 /// \{
 
+#ifdef DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
+
+/// number of bins in histogram of durations of sections with masked interrupts
+constexpr size_t interruptMaskingHistogramBins {32};
+
+/// single section with masked interrupts
+struct InterruptMaskingSection
+{
+	/// address of code which masked interrupts
+	const void* maskingAddress;
+
+	/// address of code which unmasked interrupts
+	const void* unmaskingAddress;
+
+	/// duration of section, core clock cycles
+	uint32_t duration;
+};
+
+#endif	// def DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
+
+/// usage of a single stack
+struct StackUsage
+{
+	/**
+	 * \return unused part of stack ("headroom"), bytes
+	 */
+
+	size_t getHeadroom() const
+	{
+		return size - highWaterMark;
+	}
+
+	/// identifier of thread which uses the stack, default-constructed (invalid) identifier for interrupt stack
+	ThreadIdentifier threadIdentifier;
+
+	/// size of stack, bytes
+	size_t size;
+
+	/// "high water mark" (max usage) of stack, bytes
+	size_t highWaterMark;
+};
+
 /**
  * \return number of context switches
  */
 
 uint64_t getContextSwitchCount();
 
+#ifdef DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
+
+/**
+ * \brief Gets histogram of durations of sections with masked interrupts.
+ *
+ * Bin 0 holds the number of sections shorter than 2 core clock cycles, bin n (n > 0) holds the number of sections with
+ * duration in [2^n; 2^(n + 1)) core clock cycles. Counters saturate instead of overflowing.
+ *
+ * \param [out] histogram is a range of counters which will be filled, bins which don't fit in it are skipped
+ */
+
+void getInterruptMaskingHistogram(estd::ContiguousRange<uint32_t> histogram);
+
+/**
+ * \brief Gets the longest sections with masked interrupts.
+ *
+ * \param [out] sections is a range of InterruptMaskingSection objects which will be filled, sorted by decreasing
+ * duration
+ *
+ * \return number of recorded sections (at most DISTORTOS_INTERRUPT_MASKING_STATISTICS_SECTIONS); if it is greater than
+ * size of \a sections, then the range is filled only partially
+ */
+
+size_t getLongestInterruptMaskingSections(estd::ContiguousRange<InterruptMaskingSection> sections);
+
+#endif	// def DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
+
+/**
+ * \brief Gets usage of all stacks in the system.
+ *
+ * First element describes the stack used by interrupt handlers, following elements describe stacks of all threads
+ * which exist in the system (including main thread and idle thread). For all stacks, the size and "high water mark"
+ * exclude "stack guard", so headroom of interrupt stack and of thread stacks is calculated in the same way.
+ *
+ * \note Calculation of "high water mark" requires scanning unused part of each stack, all of which is done with
+ * interrupts masked, so this function should not be used in time-critical code.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [out] stackUsages is a range of StackUsage objects which will be filled
+ *
+ * \return total number of stacks in the system; if it is greater than size of \a stackUsages, then the range is filled
+ * only partially
+ */
+
+size_t getStackUsage(estd::ContiguousRange<StackUsage> stackUsages);
+
+#ifdef DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
+
+/**
+ * \brief Clears histogram and the list of the longest sections with masked interrupts.
+ */
+
+void resetInterruptMaskingStatistics();
+
+#endif	// def DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
+
 /// \}
 
 }	// namespace statistics
@@ -0,0 +1,183 @@
+#!/usr/bin/env python
+
+#
+# file: stackUsageReport.py
+#
+# author: Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+#
+
+import argparse
+import os
+import re
+import sys
+
+nodeRegex = re.compile(r'node:\s*{\s*title:\s*"([^"]*)"\s*label:\s*"([^"]*)"')
+edgeRegex = re.compile(r'edge:\s*{\s*sourcename:\s*"([^"]*)"\s*targetname:\s*"([^"]*)"')
+stackUsageRegex = re.compile(r'(\d+) bytes \(([a-z,]+)\)')
+
+indirectCall = '__indirect_call'
+
+class Function(object):
+	"""Function from call graph"""
+
+	def __init__(self, title):
+		self.title = title
+		self.name = title
+		self.location = None
+		self.stackUsage = None
+		self.qualifier = None
+		self.callees = set()
+
+	def __repr__(self):
+		return "{}(title = {}, stackUsage = {})".format(self.__class__.__name__, self.title, self.stackUsage)
+
+class WorstCase(object):
+	"""Worst-case stack usage of function, including all of its callees"""
+
+	def __init__(self, stackUsage, path, flags):
+		self.stackUsage = stackUsage
+		self.path = path
+		self.flags = flags
+
+def parseCallGraphFile(functions, file):
+	"""Parses one call graph file produced by GCC's `-fcallgraph-info=su` and merges its contents into `functions`.
+
+	Nodes which have stack usage information are definitions, all other nodes are just references to external functions,
+	which may be defined in other files.
+
+	* `functions` is a dictionary with Function objects, indexed by title (mangled name)
+	* `file` is the file which will be parsed
+	"""
+	contents = file.read()
+	for match in nodeRegex.finditer(contents):
+		title, label = match.groups()
+		function = functions.setdefault(title, Function(title))
+		lines = label.split('\\n')
+		stackUsageMatch = stackUsageRegex.search(label)
+		if stackUsageMatch is None:
+			continue
+		function.name = lines[0]
+		function.location = lines[1] if len(lines) > 1 else None
+		function.stackUsage = int(stackUsageMatch.group(1))
+		function.qualifier = stackUsageMatch.group(2)
+	for match in edgeRegex.finditer(contents):
+		source, target = match.groups()
+		functions.setdefault(source, Function(source)).callees.add(target)
+		functions.setdefault(target, Function(target))
+
+def calculateWorstCase(functions, title, worstCases, stack):
+	"""Calculates worst-case stack usage of function, including all of its callees.
+
+	Flags in the result:
+	* `D` - dynamic stack allocation (alloca() or VLA) somewhere in the call tree;
+	* `I` - indirect call (through function pointer or virtual function) somewhere in the call tree;
+	* `R` - recursion somewhere in the call tree;
+	* `U` - function with unknown stack usage (e.g. from a library compiled without call graph info) in the call tree;
+
+	Any of these flags means that the result is only a lower bound.
+
+	* `functions` is a dictionary with Function objects, indexed by title (mangled name)
+	* `title` is the title of analyzed function
+	* `worstCases` is a dictionary with already calculated WorstCase objects, indexed by title
+	* `stack` is a list with titles of functions which are currently being analyzed
+
+	return WorstCase object for analyzed function
+	"""
+	if title in worstCases:
+		return worstCases[title]
+	if title == indirectCall:
+		return WorstCase(0, [], set('I'))
+	if title in stack:
+		return WorstCase(0, [], set('R'))
+
+	function = functions[title]
+	flags = set()
+	if function.stackUsage is None:
+		flags.add('U')
+	elif function.qualifier.startswith('dynamic') == True and function.qualifier != 'dynamic,bounded':
+		flags.add('D')
+
+	stack.append(title)
+	worstCallee = WorstCase(0, [], set())
+	for callee in sorted(function.callees):
+		calleeWorstCase = calculateWorstCase(functions, callee, worstCases, stack)
+		flags |= calleeWorstCase.flags
+		if calleeWorstCase.stackUsage > worstCallee.stackUsage:
+			worstCallee = calleeWorstCase
+	stack.pop()
+
+	worstCase = WorstCase((function.stackUsage or 0) + worstCallee.stackUsage, [title] + worstCallee.path, flags)
+	# results for functions involved in recursion depend on the entry point, so they are not cached
+	if 'R' not in flags:
+		worstCases[title] = worstCase
+	return worstCase
+
+def findCallGraphFiles(paths):
+	"""Finds all call graph files (`*.ci`) in given paths.
+
+	* `paths` is a list of files and/or directories
+
+	return list of paths to call graph files
+	"""
+	callGraphFiles = []
+	for path in paths:
+		if os.path.isdir(path) == False:
+			callGraphFiles.append(path)
+			continue
+		for root, directories, files in os.walk(path):
+			for file in files:
+				if file.endswith('.ci') == True:
+					callGraphFiles.append(os.path.join(root, file))
+	return sorted(callGraphFiles)
+
+if __name__ == '__main__':
+	parser = argparse.ArgumentParser(description = 'Calculates worst-case static stack usage of functions, using call '
+			'graph and stack usage information generated by GCC with `-fcallgraph-info=su` (enable '
+			'`distortos_Build_01_Call_graph_and_stack_usage_information` option to get these files for whole project).',
+			epilog = 'Flags: D - dynamic stack allocation, I - indirect call, R - recursion, U - unknown stack usage of '
+			'some function. Any of these flags means that the result is only a lower bound.')
+	parser.add_argument('paths', nargs = '+', help = 'call graph files (`*.ci`) or directories which will be searched '
+			'recursively for such files (e.g. build directory)')
+	parser.add_argument('-r', '--root', action = 'append', default = [], help = 'regular expression matched against '
+			'names (both mangled and demangled) of functions which should be reported, e.g. thread functions, may be '
+			'given multiple times; if omitted, all defined functions are reported')
+	parser.add_argument('-l', '--limit', type = int, default = 0, help = 'max number of reported functions, sorted by '
+			'descending worst-case stack usage, 0 - no limit (default)')
+	parser.add_argument('-p', '--path', action = 'store_true', help = 'print worst-case call path for each function')
+	arguments = parser.parse_args()
+
+	functions = {}
+	callGraphFiles = findCallGraphFiles(arguments.paths)
+	if len(callGraphFiles) == 0:
+		sys.exit('No call graph files found in {}'.format(', '.join(arguments.paths)))
+	for callGraphFile in callGraphFiles:
+		with open(callGraphFile, 'r') as file:
+			parseCallGraphFile(functions, file)
+
+	rootRegexes = [re.compile(root) for root in arguments.root]
+	worstCases = {}
+	results = []
+	for title, function in functions.items():
+		if function.stackUsage is None:
+			continue
+		if len(rootRegexes) != 0 and any(regex.search(title) is not None or regex.search(function.name) is not None
+				for regex in rootRegexes) == False:
+			continue
+		results.append((function, calculateWorstCase(functions, title, worstCases, [])))
+
+	results.sort(key = lambda result: (-result[1].stackUsage, result[0].name))
+	if arguments.limit != 0:
+		results = results[:arguments.limit]
+
+	print('{:>10} {:>10} {:5} {}'.format('worst-case', 'own', 'flags', 'function'))
+	for function, worstCase in results:
+		print('{:>10} {:>10} {:5} {}'.format(worstCase.stackUsage, function.stackUsage,
+				''.join(sorted(worstCase.flags)), function.name))
+		if arguments.path == True:
+			for title in worstCase.path[1:]:
+				callee = functions[title]
+				print('{:>10} {:>10} {:5}   -> {}'.format('', callee.stackUsage if callee.stackUsage is not None else '?',
+						'', callee.name))
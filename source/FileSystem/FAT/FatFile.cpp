@@ -17,6 +17,8 @@
 
 #include "distortos/FileSystem/FatFileSystem.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <mutex>
 
 #include <fcntl.h>
@@ -36,6 +38,45 @@ FatFile::~FatFile()
 	assert(opened_ == false);
 }
 
+int FatFile::allocate(const off_t offset, const off_t length)
+{
+	const std::lock_guard<FatFile> lockGuard {*this};
+
+	assert(opened_ == true);
+
+	if (writable_ == false)
+		return EBADF;
+	if (offset < 0 || length <= 0)
+		return EINVAL;
+	if (static_cast<uintmax_t>(offset) + static_cast<uintmax_t>(length) > std::numeric_limits<ufat_size_t>::max())
+		return EFBIG;
+
+	const ufat_size_t size = offset + length;
+	if (size <= file_.file_size)
+		return {};
+
+	const auto position = position_;
+	auto ret = ufat_file_advance(&file_, file_.file_size - file_.cur_pos);
+	if (ret >= 0)
+	{
+		ret = ufat_file_fill(&file_, size - file_.cur_pos);
+		dirty_ = true;
+	}
+
+	// restore file offset, just like seek() does
+	if (position < static_cast<off_t>(file_.cur_pos))
+		ufat_file_rewind(&file_);
+	const auto advanceRet = ufat_file_advance(&file_,
+			std::min(position, static_cast<off_t>(file_.file_size)) - file_.cur_pos);
+	position_ = advanceRet < 0 ? file_.cur_pos : position;
+	if (ret < 0)
+		return ufatErrorToErrorCode(ret);
+	if (advanceRet < 0)
+		return ufatErrorToErrorCode(advanceRet);
+
+	return {};
+}
+
 int FatFile::close()
 {
 	const std::lock_guard<FatFile> lockGuard {*this};
@@ -268,15 +309,14 @@ std::pair<int, size_t> FatFile::write(const void* const buffer, const size_t siz
 
 	assert(static_cast<decltype(file_.cur_pos)>(position_) >= file_.cur_pos);
 	const size_t fillSize = position_ - file_.cur_pos;
-	for (size_t i {}; i < fillSize; ++i)
+	if (fillSize != 0)
 	{
-		const uint8_t zero {};
-		const auto ret = ufat_file_write(&file_, &zero, sizeof(zero));
+		const auto ret = ufat_file_fill(&file_, fillSize);
 		dirty_ = true;
 		position_ = file_.cur_pos;
 		if (ret < 0)
 			return {ufatErrorToErrorCode(ret), {}};
-		assert(ret == sizeof(zero));
+		assert(static_cast<size_t>(ret) == fillSize);
 	}
 
 	const auto ret = ufat_file_write(&file_, buffer, size);
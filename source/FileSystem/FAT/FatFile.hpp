@@ -58,6 +58,33 @@ public:
 
 	~FatFile() override;
 
+	/**
+	 * \brief Allocates space for file.
+	 *
+	 * Similar to [posix_fallocate()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/posix_fallocate.html)
+	 *
+	 * If the size of the file is less than \a offset + \a length, the file is extended to this size and the added part
+	 * is filled with zeros. All clusters needed for that are allocated at once - as a single run of contiguous clusters,
+	 * if there is one which is long enough - so later writes in this range don't modify the FAT. Current file offset is
+	 * not changed.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre %File is opened.
+	 *
+	 * \param [in] offset is the offset of the beginning of the range, bytes
+	 * \param [in] length is the length of the range, bytes
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - file is not opened for writing;
+	 * - EFBIG - \a offset + \a length is greater than max size of file;
+	 * - EINVAL - \a offset is less than 0 or \a length is not greater than 0;
+	 * - converted error codes returned by ufat_file_advance();
+	 * - converted error codes returned by ufat_file_fill();
+	 */
+
+	int allocate(off_t offset, off_t length) override;
+
 	/**
 	 * \brief Closes file.
 	 *
@@ -276,6 +303,7 @@ public:
 	 * error code is returned); error codes:
 	 * - EBADF - file is not opened for writing;
 	 * - converted error codes returned by ufat_file_advance();
+	 * - converted error codes returned by ufat_file_fill();
 	 * - converted error codes returned by ufat_file_write();
 	 */
 
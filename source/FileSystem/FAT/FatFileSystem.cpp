@@ -245,6 +245,14 @@ int FatFileSystem::mount()
 	if (ret < 0)
 		return ufatErrorToErrorCode(ret);
 
+	const size_t bitmapLength {(fileSystem_.bpb.num_clusters + 31) / 32};
+	if (maxBitmapSize_ != 0 && bitmapLength * sizeof(uint32_t) <= maxBitmapSize_)
+	{
+		bitmap_.reset(new (std::nothrow) uint32_t[bitmapLength]);
+		if (bitmap_ != nullptr)
+			ufat_set_bitmap(&fileSystem_, bitmap_.get());
+	}
+
 	mounted_ = true;
 	closeScopeGuard.release();
 	return {};
@@ -376,6 +384,7 @@ int FatFileSystem::unmount()
 	assert(mounted_ == true);
 
 	ufat_close(&fileSystem_);
+	bitmap_.reset();
 	const auto ret = device_.blockDevice.close();
 	mounted_ = {};
 
@@ -311,6 +311,8 @@ int ufat_open(struct ufat *uf, const struct ufat_device *dev)
 		return -UFAT_ERR_BLOCK_SIZE;
 
 	uf->alloc_ptr = 0;
+	uf->bitmap = NULL;
+	uf->bitmap_valid = 0;
 	memset(&uf->stat, 0, sizeof(uf->stat));
 	memset(&uf->cache_desc, 0, sizeof(uf->cache_desc));
 
@@ -332,16 +334,127 @@ int ufat_sync(struct ufat *uf)
 	return ret;
 }
 
+void ufat_set_bitmap(struct ufat *uf, uint32_t *bitmap)
+{
+	uf->bitmap = bitmap;
+	uf->bitmap_valid = 0;
+}
+
+static void bitmap_update(struct ufat *uf, ufat_cluster_t idx, int is_free)
+{
+	uint32_t *word = &uf->bitmap[idx / 32];
+	const uint32_t mask = (uint32_t)1 << (idx % 32);
+
+	/* Never use this cluster index in a FAT12 system */
+	if (idx < 2 || (idx == 0xff0 && uf->bpb.type == UFAT_TYPE_FAT12))
+		return;
+
+	if (!is_free == !(*word & mask))
+		return;
+
+	*word ^= mask;
+
+	if (is_free)
+		uf->free_clusters++;
+	else
+		uf->free_clusters--;
+}
+
+/* Returns 1 if the free-cluster bitmap can be used, building it first if
+ * needed, 0 if there is no bitmap or negative error code.
+ */
+static int bitmap_ready(struct ufat *uf)
+{
+	ufat_cluster_t idx;
+
+	if (!uf->bitmap)
+		return 0;
+
+	if (uf->bitmap_valid)
+		return 1;
+
+	memset(uf->bitmap, 0, (uf->bpb.num_clusters + 31) / 32 *
+	       sizeof(*uf->bitmap));
+	uf->free_clusters = 0;
+
+	for (idx = 2; idx < uf->bpb.num_clusters; idx++) {
+		ufat_cluster_t c;
+		int err = ufat_read_fat(uf, idx, &c);
+
+		if (err < 0)
+			return err;
+
+		if (c == UFAT_CLUSTER_FREE)
+			bitmap_update(uf, idx, 1);
+	}
+
+	uf->bitmap_valid = 1;
+	return 1;
+}
+
+/* Finds the first free cluster not lower than idx with the free-cluster
+ * bitmap, returns the number of clusters if there's none.
+ */
+static ufat_cluster_t bitmap_find_free(const struct ufat *uf,
+				       ufat_cluster_t idx)
+{
+	while (idx < uf->bpb.num_clusters) {
+		const uint32_t word = uf->bitmap[idx / 32] >> (idx % 32);
+
+		if (!word) {
+			idx = (idx | 31) + 1;
+			continue;
+		}
+
+		if (word & 1)
+			return idx;
+
+		idx++;
+	}
+
+	return uf->bpb.num_clusters;
+}
+
+int ufat_is_free_cluster(struct ufat *uf, ufat_cluster_t idx)
+{
+	ufat_cluster_t c;
+	int err = bitmap_ready(uf);
+
+	if (err < 0)
+		return err;
+
+	if (err)
+		return (uf->bitmap[idx / 32] >> (idx % 32)) & 1;
+
+	/* Never use this cluster index in a FAT12 system */
+	if (idx == 0xff0 && uf->bpb.type == UFAT_TYPE_FAT12)
+		return 0;
+
+	err = ufat_read_fat(uf, idx, &c);
+	if (err < 0)
+		return err;
+
+	return c == UFAT_CLUSTER_FREE;
+}
+
 int ufat_count_free_clusters(struct ufat *uf, ufat_cluster_t *free_clusters)
 {
 	ufat_cluster_t idx;
 	ufat_cluster_t local_free_clusters = 0;
 	const ufat_cluster_t total = uf->bpb.num_clusters;
+	int err = bitmap_ready(uf);
+
+	if (err < 0)
+		return err;
+
+	if (err) {
+		*free_clusters = uf->free_clusters;
+		return 0;
+	}
 
 	/* Skip first two "special" clusters */
 	for (idx = 2; idx < total; idx++) {
 		ufat_cluster_t c;
-		int err;
 
 		/* Never use this cluster index in a FAT12 system */
 		if (idx == 0xff0 && uf->bpb.type == UFAT_TYPE_FAT12)
@@ -602,16 +715,21 @@ static int write_fat32(struct ufat *uf, ufat_cluster_t index,
 int ufat_write_fat(struct ufat *uf, ufat_cluster_t index,
 		   ufat_cluster_t in)
 {
+	int err = 0;
+
 	if (index >= uf->bpb.num_clusters)
 		return -UFAT_ERR_INVALID_CLUSTER;
 
 	switch (uf->bpb.type) {
-	case UFAT_TYPE_FAT12: return write_fat12(uf, index, in);
-	case UFAT_TYPE_FAT16: return write_fat16(uf, index, in);
-	case UFAT_TYPE_FAT32: return write_fat32(uf, index, in);
+	case UFAT_TYPE_FAT12: err = write_fat12(uf, index, in); break;
+	case UFAT_TYPE_FAT16: err = write_fat16(uf, index, in); break;
+	case UFAT_TYPE_FAT32: err = write_fat32(uf, index, in); break;
 	}
 
-	return 0;
+	if (err >= 0 && uf->bitmap_valid)
+		bitmap_update(uf, index, in == UFAT_CLUSTER_FREE);
+
+	return err;
 }
 
 int ufat_free_chain(struct ufat *uf, ufat_cluster_t c)
@@ -638,11 +756,32 @@ static int alloc_cluster(struct ufat *uf, ufat_cluster_t *out,
 {
 	const unsigned int total = uf->bpb.num_clusters - 2;
 	unsigned int i;
+	int err = bitmap_ready(uf);
+
+	if (err < 0)
+		return err;
+
+	if (err) {
+		ufat_cluster_t idx = bitmap_find_free(uf, uf->alloc_ptr + 2);
+
+		if (idx >= uf->bpb.num_clusters)
+			idx = bitmap_find_free(uf, 2);
+
+		if (idx >= uf->bpb.num_clusters)
+			return -UFAT_ERR_NO_CLUSTERS;
+
+		err = ufat_write_fat(uf, idx, tail);
+		if (err < 0)
+			return err;
+
+		uf->alloc_ptr = (idx - 1) % total;
+		*out = idx;
+		return 0;
+	}
 
 	for (i = 0; i < total; i++) {
 		const ufat_cluster_t idx = uf->alloc_ptr + 2;
 		ufat_cluster_t c;
-		int err;
 
 		uf->alloc_ptr = (uf->alloc_ptr + 1) % total;
 
@@ -687,3 +826,93 @@ int ufat_alloc_chain(struct ufat *uf, unsigned int count, ufat_cluster_t *out)
 	*out = chain;
 	return 0;
 }
+
+int ufat_alloc_run(struct ufat *uf, ufat_cluster_t first, unsigned int count,
+		   ufat_cluster_t *out)
+{
+	const unsigned int total = uf->bpb.num_clusters - 2;
+	ufat_cluster_t chain = UFAT_CLUSTER_EOC;
+	ufat_cluster_t tail = UFAT_CLUSTER_EOC;
+	ufat_cluster_t run_start = 0;
+	unsigned int run_length = 0;
+	ufat_cluster_t idx = first;
+	unsigned int i;
+
+	if (idx < 2 || idx >= uf->bpb.num_clusters)
+		idx = 2;
+
+	/* Look for a run of free clusters which is long enough. Runs can't
+	 * wrap around the end of the FAT.
+	 */
+	for (i = 0; i < total && run_length < count; i++, idx++) {
+		int err;
+
+		if (idx >= uf->bpb.num_clusters) {
+			idx = 2;
+			run_length = 0;
+		}
+
+		err = ufat_is_free_cluster(uf, idx);
+		if (err < 0)
+			return err;
+
+		if (!err) {
+			run_length = 0;
+			continue;
+		}
+
+		if (!run_length)
+			run_start = idx;
+
+		run_length++;
+	}
+
+	if (run_length == count) {
+		/* Link the run from its end, so that the chain is always
+		 * terminated and can be freed on error.
+		 */
+		idx = run_start + count;
+		while (idx-- > run_start) {
+			int err = ufat_write_fat(uf, idx, chain);
+
+			if (err < 0) {
+				ufat_free_chain(uf, chain);
+				return err;
+			}
+
+			chain = idx;
+		}
+
+		uf->alloc_ptr = (run_start + count - 2) % total;
+		*out = chain;
+		return 0;
+	}
+
+	/* There's no run which is long enough, so take free clusters one by
+	 * one, wherever they are.
+	 */
+	while (count) {
+		ufat_cluster_t c;
+		int err = alloc_cluster(uf, &c, UFAT_CLUSTER_EOC);
+
+		if (err >= 0 && UFAT_CLUSTER_IS_PTR(tail)) {
+			err = ufat_write_fat(uf, tail, c);
+			if (err < 0)
+				ufat_free_chain(uf, c);
+		}
+
+		if (err < 0) {
+			ufat_free_chain(uf, chain);
+			return err;
+		}
+
+		if (!UFAT_CLUSTER_IS_PTR(chain))
+			chain = c;
+
+		tail = c;
+		count--;
+	}
+
+	*out = chain;
+	return 0;
+}
@@ -140,6 +140,11 @@ struct ufat {
 	unsigned int			cache_size;
 	ufat_cluster_t			alloc_ptr;
 
+	/* Optional free-cluster bitmap, see ufat_set_bitmap() */
+	uint32_t			*bitmap;
+	ufat_cluster_t			free_clusters;
+	int				bitmap_valid;
+
 	struct ufat_cache_desc		cache_desc[UFAT_CACHE_MAX_BLOCKS];
 	uint8_t				cache_data[UFAT_CACHE_BYTES];
 };
@@ -204,6 +209,26 @@ int ufat_open(struct ufat *uf, const struct ufat_device *dev);
 
 int ufat_sync(struct ufat *uf);
 
+/**
+ * \brief Sets buffer for free-cluster bitmap.
+ *
+ * With the bitmap, free clusters are found and counted without reading the
+ * FAT. The bitmap is built with a single scan of the FAT when it is needed for
+ * the first time, later it is updated by all operations which modify the FAT.
+ *
+ * \pre `uf` is a valid pointer.
+ * \pre The filesystem pointed by `uf` is opened.
+ * \pre `bitmap` is either `NULL` or points to a buffer with at least
+ * `(uf->bpb.num_clusters + 31) / 32` elements, which stays valid until the
+ * filesystem is closed or the bitmap is disabled.
+ *
+ * \param [in] uf is a pointer to the filesystem
+ * \param [in] bitmap is a pointer to buffer for free-cluster bitmap, `NULL` to
+ * disable the bitmap
+ */
+
+void ufat_set_bitmap(struct ufat *uf, uint32_t *bitmap);
+
 /**
  * \brief Count number of free clusters.
  *
@@ -607,6 +632,25 @@ int ufat_file_read(struct ufat_file *f, void *buf, ufat_size_t max_size);
 
 int ufat_file_write(struct ufat_file *f, const void *buf, ufat_size_t len);
 
+/**
+ * \brief Writes zeros to file.
+ *
+ * All clusters needed for the operation are allocated at once, as a single
+ * run of contiguous clusters if possible. Zeros are written to the device in
+ * whole blocks, without reading them first.
+ *
+ * \pre `f` is a valid pointer.
+ * \pre File pointed by `f` is opened.
+ *
+ * \param [in] f is a pointer to a file
+ * \param [in] len is the number of zero bytes to write
+ *
+ * \return number of written bytes on success, negative error code
+ * (`ufat_error_t`) otherwise
+ */
+
+int ufat_file_fill(struct ufat_file *f, ufat_size_t len);
+
 /**
  * \brief Truncates file.
  *
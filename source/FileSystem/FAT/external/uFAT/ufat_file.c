@@ -137,6 +137,52 @@ static int read_block_fragment(struct ufat_file *f, char *buf, ufat_size_t size)
 	return size;
 }
 
+/* Counts blocks which can be accessed with a single transfer, starting at
+ * the current position. The transfer is extended over following clusters
+ * of the chain, as long as they are contiguous. If can_alloc is not 0, the
+ * chain is extended with newly allocated clusters when it ends before the
+ * requested number of blocks.
+ */
+static int contiguous_blocks(struct ufat_file *f, unsigned int requested_blocks,
+			     unsigned int block_remainder, int can_alloc)
+{
+	struct ufat *uf = f->uf;
+	const unsigned int blocks_per_cluster =
+		1 << uf->bpb.log2_blocks_per_cluster;
+	ufat_cluster_t c = f->cur_cluster;
+	unsigned int run_blocks = block_remainder;
+
+	while (run_blocks < requested_blocks) {
+		ufat_cluster_t next;
+		int i = ufat_read_fat(uf, c, &next);
+
+		if (i < 0)
+			return i;
+
+		if (!UFAT_CLUSTER_IS_PTR(next) && can_alloc) {
+			i = ufat_alloc_chain(uf, 1, &next);
+			if (i == -UFAT_ERR_NO_CLUSTERS)
+				break;
+			if (i < 0)
+				return i;
+
+			i = ufat_write_fat(uf, c, next);
+			if (i < 0) {
+				ufat_free_chain(uf, next);
+				return i;
+			}
+		}
+
+		if (!UFAT_CLUSTER_IS_PTR(next) || next != c + 1)
+			break;
+
+		c = next;
+		run_blocks += blocks_per_cluster;
+	}
+
+	return run_blocks < requested_blocks ? run_blocks : requested_blocks;
+}
+
 static int read_blocks(struct ufat_file *f, char *buf, ufat_size_t size)
 {
 	struct ufat *uf = f->uf;
@@ -152,16 +198,21 @@ static int read_blocks(struct ufat_file *f, char *buf, ufat_size_t size)
 	unsigned int requested_blocks = size >> log2_block_size;
 	int i;
 
-	if (requested_blocks > block_remainder)
-		requested_blocks = block_remainder;
 	if (!requested_blocks)
 		return 0;
 
 	if (!UFAT_CLUSTER_IS_PTR(f->cur_cluster))
 		return -UFAT_ERR_INVALID_CLUSTER;
 
-	/* We're reading contiguous whole blocks, so we can bypass the
-	 * cache and perform a single large read.
+	i = contiguous_blocks(f, requested_blocks, block_remainder, 0);
+	if (i < 0)
+		return i;
+
+	requested_blocks = i;
+
+	/* We're reading contiguous whole blocks (possibly spanning multiple
+	 * clusters), so we can bypass the cache and perform a single large
+	 * read.
 	 */
 	starting_block = cluster_to_block(bpb, f->cur_cluster) + block_offset;
 	i = ufat_cache_evict(uf, starting_block, requested_blocks);
@@ -199,7 +250,7 @@ int ufat_file_read(struct ufat_file *f, void *buf, ufat_size_t size)
 	buf = (char*)buf + len;
 	size -= len;
 
-	/* Read contiguous blocks within a cluster */
+	/* Read contiguous blocks */
 	for (;;) {
 		len = read_blocks(f, buf, size);
 
@@ -334,8 +385,6 @@ static int write_blocks(struct ufat_file *f, const char *buf, ufat_size_t size)
 	unsigned int requested_blocks = size >> log2_block_size;
 	int i;
 
-	if (requested_blocks > block_remainder)
-		requested_blocks = block_remainder;
 	if (!requested_blocks)
 		return 0;
 
@@ -343,8 +392,15 @@ static int write_blocks(struct ufat_file *f, const char *buf, ufat_size_t size)
 	if (i < 0)
 		return i;
 
-	/* We're writing contiguous whole blocks, so we can bypass the
-	 * cache and perform a single large write.
+	i = contiguous_blocks(f, requested_blocks, block_remainder, 1);
+	if (i < 0)
+		return i;
+
+	requested_blocks = i;
+
+	/* We're writing contiguous whole blocks (possibly spanning multiple
+	 * clusters), so we can bypass the cache and perform a single large
+	 * write.
 	 */
 	starting_block = cluster_to_block(bpb, f->cur_cluster) + block_offset;
 	ufat_cache_invalidate(uf, starting_block, requested_blocks);
@@ -409,6 +465,130 @@ int ufat_file_write(struct ufat_file *f, const void *buf, ufat_size_t len)
 	return total;
 }
 
+/* Extends the cluster chain of the file, so that it covers end_pos bytes.
+ * All missing clusters are allocated at once, preferably as a single run
+ * which continues the existing chain.
+ */
+static int extend_chain(struct ufat_file *f, ufat_size_t end_pos)
+{
+	struct ufat *uf = f->uf;
+	const unsigned int log2_cluster_size =
+		uf->dev->log2_block_size + uf->bpb.log2_blocks_per_cluster;
+	const unsigned int needed = (end_pos >> log2_cluster_size) +
+		((end_pos & ((1 << log2_cluster_size) - 1)) != 0);
+	unsigned int nclusters = f->cur_pos >> log2_cluster_size;
+	ufat_cluster_t tail = f->prev_cluster;
+	ufat_cluster_t c = f->cur_cluster;
+	int err;
+
+	/* Find the end of the existing chain */
+	while (UFAT_CLUSTER_IS_PTR(c) && nclusters < needed) {
+		tail = c;
+		nclusters++;
+
+		err = ufat_read_fat(uf, c, &c);
+		if (err < 0)
+			return err;
+	}
+
+	if (nclusters >= needed)
+		return 0;
+
+	err = ufat_alloc_run(uf, UFAT_CLUSTER_IS_PTR(tail) ? tail + 1 :
+			     uf->alloc_ptr + 2, needed - nclusters, &c);
+	if (err < 0)
+		return err;
+
+	if (UFAT_CLUSTER_IS_PTR(tail))
+		err = ufat_write_fat(uf, tail, c);
+	else
+		err = set_start(f, c);
+
+	if (err < 0) {
+		ufat_free_chain(uf, c);
+		return err;
+	}
+
+	/* Current position is at the end of the old chain */
+	if (!UFAT_CLUSTER_IS_PTR(f->cur_cluster))
+		f->cur_cluster = c;
+
+	return 0;
+}
+
+static int fill_block(struct ufat_file *f, ufat_size_t size)
+{
+	const struct ufat_bpb *bpb = &f->uf->bpb;
+	const unsigned int log2_block_size = f->uf->dev->log2_block_size;
+	const unsigned int block_size = 1 << log2_block_size;
+	const unsigned int offset = f->cur_pos & (block_size - 1);
+	const unsigned int remainder = block_size - offset;
+	ufat_block_t cur_block;
+	int i;
+
+	if (size > remainder)
+		size = remainder;
+
+	i = ensure_room(f);
+	if (i < 0)
+		return i;
+
+	cur_block =
+		cluster_to_block(bpb, f->cur_cluster) +
+		((f->cur_pos >> log2_block_size) &
+		 ((1 << bpb->log2_blocks_per_cluster) - 1));
+
+	/* Whole blocks don't have to be read, they will be written from the
+	 * cache when it gets flushed.
+	 */
+	i = ufat_cache_open(f->uf, cur_block, size == block_size);
+	if (i < 0)
+		return i;
+
+	ufat_cache_write(f->uf, i);
+	memset(ufat_cache_data(f->uf, i) + offset, 0, size);
+
+	i = advance_ptr(f, size);
+	if (i < 0)
+		return i;
+
+	return size;
+}
+
+int ufat_file_fill(struct ufat_file *f, ufat_size_t len)
+{
+	const ufat_size_t max_write = ~f->cur_pos;
+	ufat_size_t total;
+	int i;
+
+	if (len > max_write)
+		len = max_write;
+	total = len;
+
+	if (!len)
+		return 0;
+
+	i = extend_chain(f, f->cur_pos + len);
+	if (i < 0)
+		return i;
+
+	while (len) {
+		i = fill_block(f, len);
+		if (i < 0)
+			return i;
+
+		len -= i;
+	}
+
+	if (f->cur_pos > f->file_size) {
+		i = set_size(f, f->cur_pos);
+		if (i < 0)
+			return i;
+	}
+
+	return total;
+}
+
 int ufat_file_truncate(struct ufat_file *f)
 {
 	const unsigned int
@@ -151,9 +151,16 @@ int ufat_write_fat(struct ufat *uf, ufat_cluster_t index,
 		   ufat_cluster_t in);
 
 /* High-level FAT operations */
+int ufat_is_free_cluster(struct ufat *uf, ufat_cluster_t idx);
 int ufat_free_chain(struct ufat *uf, ufat_cluster_t start);
 int ufat_alloc_chain(struct ufat *uf, unsigned int count, ufat_cluster_t *out);
 
+/* Allocate a chain of clusters in ascending order, preferably as a single
+ * run of contiguous clusters, searched for starting at the given cluster.
+ */
+int ufat_alloc_run(struct ufat *uf, ufat_cluster_t first, unsigned int count,
+		   ufat_cluster_t *out);
+
 /* LFN handling */
 struct ufat_lfn_parser {
 	ufat_block_t	start_block;
@@ -0,0 +1,61 @@
+/**
+ * \file
+ * \brief File class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/FileSystem/File.hpp"
+
+#include <mutex>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, size_t> File::readAt(const off_t position, void* const buffer, const size_t size)
+{
+	const std::lock_guard<File> lockGuard {*this};
+
+	const auto getPositionRet = getPosition();
+	if (getPositionRet.first != 0)
+		return {getPositionRet.first, {}};
+
+	{
+		const auto ret = seek(Whence::beginning, position);
+		if (ret.first != 0)
+			return {ret.first, {}};
+	}
+
+	const auto ret = read(buffer, size);
+	const auto seekRet = seek(Whence::beginning, getPositionRet.second);
+	return {ret.first != 0 ? ret.first : seekRet.first, ret.second};
+}
+
+std::pair<int, size_t> File::writeAt(const off_t position, const void* const buffer, const size_t size)
+{
+	const std::lock_guard<File> lockGuard {*this};
+
+	const auto getPositionRet = getPosition();
+	if (getPositionRet.first != 0)
+		return {getPositionRet.first, {}};
+
+	{
+		const auto ret = seek(Whence::beginning, position);
+		if (ret.first != 0)
+			return {ret.first, {}};
+	}
+
+	const auto ret = write(buffer, size);
+	const auto seekRet = seek(Whence::beginning, getPositionRet.second);
+	return {ret.first != 0 ? ret.first : seekRet.first, ret.second};
+}
+
+}	// namespace distortos
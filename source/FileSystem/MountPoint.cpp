@@ -15,7 +15,9 @@
 
 #include "distortos/FileSystem/FileSystem.hpp"
 
-#include <mutex>
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <limits>
 
 #include <cassert>
 #include <cstring>
@@ -31,9 +33,9 @@ namespace internal
 +---------------------------------------------------------------------------------------------------------------------*/
 
 MountPoint::MountPoint(FileSystem& fileSystem, const char* const name, const size_t length) :
-		mutex_{Mutex::Protocol::priorityInheritance},
 		fileSystem_{fileSystem},
 		name_{},
+		nameLength_{static_cast<uint8_t>(length)},
 		referenceCount_{}
 {
 	assert(length <= maxNameLength);
@@ -48,7 +50,7 @@ MountPoint::~MountPoint()
 void MountPoint::decrementReferenceCount()
 {
 	{
-		const std::lock_guard<Mutex> lockGuard {mutex_};
+		const InterruptMaskingLock interruptMaskingLock;
 
 		assert(referenceCount_ != 0);
 		--referenceCount_;
@@ -65,7 +67,7 @@ void MountPoint::decrementReferenceCount()
 
 void MountPoint::incrementReferenceCount()
 {
-	const std::lock_guard<Mutex> lockGuard {mutex_};
+	const InterruptMaskingLock interruptMaskingLock;
 
 	assert(referenceCount_ != std::numeric_limits<decltype(referenceCount_)>::max());
 	++referenceCount_;
@@ -30,6 +30,12 @@ VirtualFile::~VirtualFile()
 	assert(isOpened() == false);
 }
 
+int VirtualFile::allocate(const off_t offset, const off_t length)
+{
+	assert(isOpened() == true);
+	return file_->allocate(offset, length);
+}
+
 int VirtualFile::close()
 {
 	assert(isOpened() == true);
@@ -76,6 +82,12 @@ std::pair<int, size_t> VirtualFile::read(void* const buffer, const size_t size)
 	return file_->read(buffer, size);
 }
 
+std::pair<int, size_t> VirtualFile::readAt(const off_t position, void* const buffer, const size_t size)
+{
+	assert(isOpened() == true);
+	return file_->readAt(position, buffer, size);
+}
+
 int VirtualFile::rewind()
 {
 	assert(isOpened() == true);
@@ -106,6 +118,12 @@ std::pair<int, size_t> VirtualFile::write(const void* const buffer, const size_t
 	return file_->write(buffer, size);
 }
 
+std::pair<int, size_t> VirtualFile::writeAt(const off_t position, const void* const buffer, const size_t size)
+{
+	assert(isOpened() == true);
+	return file_->writeAt(position, buffer, size);
+}
+
 }	// namespace internal
 
 }	// namespace distortos
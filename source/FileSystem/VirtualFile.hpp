@@ -53,6 +53,22 @@ public:
 
 	~VirtualFile() override;
 
+	/**
+	 * \brief Allocates space for file.
+	 *
+	 * Similar to [posix_fallocate()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/posix_fallocate.html)
+	 *
+	 * \pre %File is opened.
+	 *
+	 * \param [in] offset is the offset of the beginning of the range, bytes
+	 * \param [in] length is the length of the range, bytes
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by File::allocate();
+	 */
+
+	int allocate(off_t offset, off_t length) override;
+
 	/**
 	 * \brief Closes file.
 	 *
@@ -157,6 +173,24 @@ public:
 
 	std::pair<int, size_t> read(void* buffer, size_t size) override;
 
+	/**
+	 * \brief Reads data from file at given position.
+	 *
+	 * Similar to [pread()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/pread.html)
+	 *
+	 * \pre \a buffer is valid.
+	 *
+	 * \param [in] position is the position in file from which the data will be read, bytes
+	 * \param [out] buffer is the buffer into which the data will be read, must be valid
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by File::readAt();
+	 */
+
+	std::pair<int, size_t> readAt(off_t position, void* buffer, size_t size) override;
+
 	/**
 	 * \brief Resets current file offset.
 	 *
@@ -230,6 +264,24 @@ public:
 
 	std::pair<int, size_t> write(const void* buffer, size_t size) override;
 
+	/**
+	 * \brief Writes data to file at given position.
+	 *
+	 * Similar to [pwrite()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/pwrite.html)
+	 *
+	 * \pre \a buffer is valid.
+	 *
+	 * \param [in] position is the position in file at which the data will be written, bytes
+	 * \param [in] buffer is the buffer with data that will be written, must be valid
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of written bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by File::writeAt();
+	 */
+
+	std::pair<int, size_t> writeAt(off_t position, const void* buffer, size_t size) override;
+
 private:
 
 	/**
@@ -18,12 +18,16 @@
 
 #include "distortos/FileSystem/FileSystem.hpp"
 
+#include "distortos/InterruptMaskingLock.hpp"
+
 #include "estd/ContiguousRange.hpp"
 #include "estd/ScopeGuard.hpp"
 
-#include <mutex>
+#include <algorithm>
 
 #include <cassert>
+#include <cctype>
+#include <cerrno>
 #include <cstring>
 
 namespace distortos
@@ -161,7 +165,7 @@ int VirtualFileSystem::mount(FileSystem& fileSystem, const char* const path)
 		return ENOMEM;
 
 	{
-		const std::lock_guard<Mutex> lockGuard {mutex_};
+		const InterruptMaskingLock interruptMaskingLock;
 		mountPoints_.push_back(*node.release());
 	}
 
@@ -254,13 +258,12 @@ int VirtualFileSystem::unmount(const char* const path, const bool detach)
 	std::unique_ptr<MountPointListNode> node;
 
 	{
-		const std::lock_guard<Mutex> lockGuard {mutex_};
+		const InterruptMaskingLock interruptMaskingLock;
 
 		const auto iterator = std::find_if(mountPoints_.begin(), mountPoints_.end(),
 				[name, length](const MountPointSharedPointer& entry) -> bool
 				{
-					const auto entryName = entry->getName();
-					return strlen(entryName) == length && memcmp(entryName, name, length) == 0;
+					return entry->getNameLength() == length && memcmp(entry->getName(), name, length) == 0;
 				});
 
 		assert(iterator != mountPoints_.end());
@@ -282,13 +285,13 @@ MountPointSharedPointer VirtualFileSystem::getMountPointSharedPointer(const char
 {
 	assert(name != nullptr);
 
-	const std::lock_guard<Mutex> lockGuard {mutex_};
+	// the list is short and each entry is rejected by its length in most cases, so interrupts are masked only briefly
+	const InterruptMaskingLock interruptMaskingLock;
 
 	const auto iterator = std::find_if(mountPoints_.begin(), mountPoints_.end(),
 			[name, length](const MountPointSharedPointer& entry) -> bool
 			{
-				const auto entryName = entry->getName();
-				return strlen(entryName) == length && memcmp(entryName, name, length) == 0;
+				return entry->getNameLength() == length && memcmp(entry->getName(), name, length) == 0;
 			});
 
 	if (iterator == mountPoints_.end())
@@ -19,21 +19,38 @@ distortosSetConfiguration(BOOLEAN
 		- support for (most likely) all functions from <stdio.h> header, like fopen(), fclose(), fread(), fwrite(),
 		fprintf(), fscanf() and so on;
 		- support for selected I/O-related functions from <fcntl.h>, <unistd.h> and <sys/stat.h> headers: open(),
-		close(), read(), write(), isatty(), lseek(), fstat(), mkdir(), stat() and unlink() (which supports both files
-		and directories);
+		close(), read(), write(), pread(), pwrite(), isatty(), lseek(), fstat(), mkdir(), stat() and unlink() (which
+		supports both files and directories);
 		- support for selected functions from <dirent.h> header: opendir(), closedir(), readdir_r(), rewinddir(),
 		seekdir() and telldir();
 		- support for statvfs() function from <sys/statvfs.h> header;"
 		OUTPUT_NAME DISTORTOS_FILESYSTEMS_STANDARD_LIBRARY_INTEGRATION_ENABLE)
 
+if(distortos_FileSystems_00_Integration_with_standard_library)
+
+	distortosSetConfiguration(INTEGER
+			distortos_FileSystems_01_Max_number_of_file_descriptors
+			20
+			MIN 1
+			MAX 255
+			HELP "Max number of file descriptors which may be opened simultaneously.
+
+			Each file descriptor uses one pointer in statically allocated table of file descriptors."
+			OUTPUT_NAME DISTORTOS_FILESYSTEMS_FILE_DESCRIPTORS_MAX)
+
+endif()
+
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/closedir.cpp
+		${CMAKE_CURRENT_LIST_DIR}/File.cpp
 		${CMAKE_CURRENT_LIST_DIR}/fileDescriptions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/mkdir.cpp
 		${CMAKE_CURRENT_LIST_DIR}/mount.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MountPoint.cpp
 		${CMAKE_CURRENT_LIST_DIR}/opendir.cpp
 		${CMAKE_CURRENT_LIST_DIR}/openFile.cpp
+		${CMAKE_CURRENT_LIST_DIR}/pread.cpp
+		${CMAKE_CURRENT_LIST_DIR}/pwrite.cpp
 		${CMAKE_CURRENT_LIST_DIR}/readdir_r.cpp
 		${CMAKE_CURRENT_LIST_DIR}/rewinddir.cpp
 		${CMAKE_CURRENT_LIST_DIR}/rootFileSystem.cpp
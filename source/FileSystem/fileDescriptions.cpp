@@ -27,7 +27,7 @@ namespace internal
 | global objects
 +---------------------------------------------------------------------------------------------------------------------*/
 
-std::array<std::unique_ptr<File>, 20> fileDescriptions {};
+std::array<std::unique_ptr<File>, DISTORTOS_FILESYSTEMS_FILE_DESCRIPTORS_MAX> fileDescriptions {};
 
 uint8_t fileDescriptionsCount {};
 
@@ -2,7 +2,7 @@
  * \file
  * \brief Littlefs1File class implementation
  *
- * \author Copyright (C) 2018-2022 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -24,6 +24,22 @@
 namespace distortos
 {
 
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// offset of Littlefs1File object in its storage, pointer to file system which owns the storage is placed before it
+constexpr size_t objectOffset {alignof(std::max_align_t)};
+
+static_assert(sizeof(Littlefs1FileSystem*) <= objectOffset, "Pointer to file system does not fit before the object!");
+static_assert(objectOffset + sizeof(Littlefs1File) <= sizeof(Littlefs1FileSystem::FileStorage),
+		"Littlefs1FileSystem::FileStorage is too small for Littlefs1File!");
+
+}	// namespace
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -33,6 +49,61 @@ Littlefs1File::~Littlefs1File()
 	assert(opened_ == false);
 }
 
+void* Littlefs1File::operator new(const size_t size, Littlefs1FileSystem& fileSystem, const std::nothrow_t&) noexcept
+{
+	assert(objectOffset + size <= sizeof(Littlefs1FileSystem::FileStorage));
+
+	const auto pool = fileSystem.buffers_.fileStorages != nullptr;
+	const auto storage = pool == true ? static_cast<void*>(fileSystem.allocateFileStorage()) :
+			::operator new(objectOffset + size, std::nothrow);
+	if (storage == nullptr)
+		return {};
+
+	*static_cast<Littlefs1FileSystem**>(storage) = pool == true ? &fileSystem : nullptr;
+	return static_cast<uint8_t*>(storage) + objectOffset;
+}
+
+void Littlefs1File::operator delete(void* const storage) noexcept
+{
+	if (storage == nullptr)
+		return;
+
+	const auto realStorage = static_cast<uint8_t*>(storage) - objectOffset;
+	const auto fileSystem = *reinterpret_cast<Littlefs1FileSystem**>(realStorage);
+	if (fileSystem == nullptr)
+	{
+		::operator delete(realStorage);
+		return;
+	}
+
+	const std::lock_guard<Littlefs1FileSystem> lockGuard {*fileSystem};
+	fileSystem->deallocateFileStorage(reinterpret_cast<const Littlefs1FileSystem::FileStorage*>(realStorage));
+}
+
+int Littlefs1File::allocate(const off_t offset, const off_t length)
+{
+	const std::lock_guard<Littlefs1File> lockGuard {*this};
+
+	assert(opened_ == true);
+
+	if (writable_ == false)
+		return EBADF;
+	if (offset < 0 || length <= 0)
+		return EINVAL;
+	if (length > LFS1_FILE_MAX - offset)
+		return EFBIG;
+
+	const auto size = lfs1_file_size(&fileSystem_.fileSystem_, &file_);
+	if (size < 0)
+		return littlefs1ErrorToErrorCode(size);
+
+	if (offset + length <= size)
+		return {};
+
+	const auto ret = lfs1_file_truncate(&fileSystem_.fileSystem_, &file_, offset + length);
+	return littlefs1ErrorToErrorCode(ret);
+}
+
 int Littlefs1File::close()
 {
 	const std::lock_guard<Littlefs1File> lockGuard {*this};
@@ -41,6 +112,7 @@ int Littlefs1File::close()
 
 	opened_ = {};
 	const auto ret = lfs1_file_close(&fileSystem_.fileSystem_, &file_);
+	fileSystem_.deallocateFileBuffer(fileConfiguration_.buffer);
 	return littlefs1ErrorToErrorCode(ret);
 }
 
@@ -125,9 +197,18 @@ int Littlefs1File::open(const char* const path, const int flags)
 	if ((flags & O_APPEND) != 0)
 		convertedFlags |= LFS1_O_APPEND;
 
-	const auto ret = lfs1_file_open(&fileSystem_.fileSystem_, &file_, path, convertedFlags);
+	const auto allocateRet = fileSystem_.allocateFileBuffer();
+	if (allocateRet.first != 0)
+		return allocateRet.first;
+
+	fileConfiguration_ = {};
+	fileConfiguration_.buffer = allocateRet.second;
+	const auto ret = lfs1_file_opencfg(&fileSystem_.fileSystem_, &file_, path, convertedFlags, &fileConfiguration_);
 	if (ret != LFS1_ERR_OK)
+	{
+		fileSystem_.deallocateFileBuffer(fileConfiguration_.buffer);
 		return littlefs1ErrorToErrorCode(ret);
+	}
 
 	opened_ = true;
 	return {};
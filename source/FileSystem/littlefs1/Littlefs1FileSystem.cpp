@@ -2,7 +2,7 @@
  * \file
  * \brief Littlefs1FileSystem class implementation
  *
- * \author Copyright (C) 2018-2022 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -22,6 +22,7 @@
 #include <mutex>
 
 #include <cassert>
+#include <climits>
 
 namespace distortos
 {
@@ -184,6 +185,7 @@ int littlefs1MemoryTechnologyDeviceSynchronize(const lfs1_config* const configur
 Littlefs1FileSystem::~Littlefs1FileSystem()
 {
 	assert(mounted_ == false);
+	assert(usedFileStorages_ == 0);
 }
 
 int Littlefs1FileSystem::format()
@@ -216,7 +218,10 @@ int Littlefs1FileSystem::format()
 	configuration_.block_size = eraseBlockSize_ != 0 ? eraseBlockSize_ : memoryTechnologyDevice_.getEraseBlockSize();
 	configuration_.block_count =
 			blocksCount_ != 0 ? blocksCount_ : (memoryTechnologyDevice_.getSize() / configuration_.block_size);
-	configuration_.lookahead = (std::max(lookahead_, 1u) + 31) / 32 * 32;
+	configuration_.lookahead = (std::max<size_t>(lookahead_, 1) + 31) / 32 * 32;
+	configuration_.read_buffer = buffers_.readBuffer;
+	configuration_.prog_buffer = buffers_.programBuffer;
+	configuration_.lookahead_buffer = buffers_.lookaheadBuffer;
 
 	const auto ret = lfs1_format(&fileSystem_, &configuration_);
 	return littlefs1ErrorToErrorCode(ret);
@@ -309,12 +314,16 @@ int Littlefs1FileSystem::mount()
 	configuration_.block_size = eraseBlockSize_ != 0 ? eraseBlockSize_ : memoryTechnologyDevice_.getEraseBlockSize();
 	configuration_.block_count =
 			blocksCount_ != 0 ? blocksCount_ : (memoryTechnologyDevice_.getSize() / configuration_.block_size);
-	configuration_.lookahead = (std::max(lookahead_, 1u) + 31) / 32 * 32;
+	configuration_.lookahead = (std::max<size_t>(lookahead_, 1) + 31) / 32 * 32;
+	configuration_.read_buffer = buffers_.readBuffer;
+	configuration_.prog_buffer = buffers_.programBuffer;
+	configuration_.lookahead_buffer = buffers_.lookaheadBuffer;
 
 	const auto ret = lfs1_mount(&fileSystem_, &configuration_);
 	if (ret != LFS1_ERR_OK)
 		return littlefs1ErrorToErrorCode(ret);
 
+	usedFileBuffers_ = {};
 	mounted_ = true;
 	closeScopeGuard.release();
 	return 0;
@@ -343,9 +352,9 @@ std::pair<int, std::unique_ptr<File>> Littlefs1FileSystem::openFile(const char*
 
 	assert(mounted_ == true);
 
-	std::unique_ptr<Littlefs1File> file {new (std::nothrow) Littlefs1File{*this}};
+	std::unique_ptr<Littlefs1File> file {new (*this, std::nothrow) Littlefs1File{*this}};
 	if (file == nullptr)
-		return {ENOMEM, std::unique_ptr<Littlefs1File>{}};
+		return {buffers_.fileStorages != nullptr ? EMFILE : ENOMEM, std::unique_ptr<Littlefs1File>{}};
 
 	const auto ret = file->open(path, flags);
 	if (ret != 0)
@@ -396,4 +405,62 @@ int Littlefs1FileSystem::unmount()
 	return unmountRet != LFS1_ERR_OK ? littlefs1ErrorToErrorCode(unmountRet) : closeRet;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, void*> Littlefs1FileSystem::allocateFileBuffer()
+{
+	assert(buffers_.fileBuffersCount <= sizeof(usedFileBuffers_) * CHAR_BIT);
+
+	if (buffers_.fileBuffers == nullptr)
+		return {{}, nullptr};
+
+	const auto freeFileBuffers = ~usedFileBuffers_;
+	if (freeFileBuffers == 0)
+		return {EMFILE, nullptr};
+
+	const auto index = static_cast<size_t>(__builtin_ctz(freeFileBuffers));
+	if (index >= buffers_.fileBuffersCount)
+		return {EMFILE, nullptr};
+
+	usedFileBuffers_ |= 1u << index;
+	return {{}, static_cast<uint8_t*>(buffers_.fileBuffers) + index * configuration_.prog_size};
+}
+
+void Littlefs1FileSystem::deallocateFileBuffer(const void* const fileBuffer)
+{
+	if (fileBuffer == nullptr)
+		return;
+
+	const size_t offset = static_cast<const uint8_t*>(fileBuffer) - static_cast<const uint8_t*>(buffers_.fileBuffers);
+	const auto index = offset / configuration_.prog_size;
+	assert(index < buffers_.fileBuffersCount && (usedFileBuffers_ & 1u << index) != 0);
+	usedFileBuffers_ &= ~(1u << index);
+}
+
+Littlefs1FileSystem::FileStorage* Littlefs1FileSystem::allocateFileStorage()
+{
+	assert(buffers_.fileStorages != nullptr);
+	assert(buffers_.fileBuffersCount <= sizeof(usedFileStorages_) * CHAR_BIT);
+
+	const auto freeFileStorages = ~usedFileStorages_;
+	if (freeFileStorages == 0)
+		return {};
+
+	const auto index = static_cast<size_t>(__builtin_ctz(freeFileStorages));
+	if (index >= buffers_.fileBuffersCount)
+		return {};
+
+	usedFileStorages_ |= 1u << index;
+	return buffers_.fileStorages + index;
+}
+
+void Littlefs1FileSystem::deallocateFileStorage(const FileStorage* const fileStorage)
+{
+	const auto index = static_cast<size_t>(fileStorage - buffers_.fileStorages);
+	assert(index < buffers_.fileBuffersCount && (usedFileStorages_ & 1u << index) != 0);
+	usedFileStorages_ &= ~(1u << index);
+}
+
 }	// namespace distortos
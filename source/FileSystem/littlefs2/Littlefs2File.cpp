@@ -2,7 +2,7 @@
  * \file
  * \brief Littlefs2File class implementation
  *
- * \author Copyright (C) 2019-2022 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2019-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -24,6 +24,22 @@
 namespace distortos
 {
 
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// offset of Littlefs2File object in its storage, pointer to file system which owns the storage is placed before it
+constexpr size_t objectOffset {alignof(std::max_align_t)};
+
+static_assert(sizeof(Littlefs2FileSystem*) <= objectOffset, "Pointer to file system does not fit before the object!");
+static_assert(objectOffset + sizeof(Littlefs2File) <= sizeof(Littlefs2FileSystem::FileStorage),
+		"Littlefs2FileSystem::FileStorage is too small for Littlefs2File!");
+
+}	// namespace
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -33,6 +49,61 @@ Littlefs2File::~Littlefs2File()
 	assert(opened_ == false);
 }
 
+void* Littlefs2File::operator new(const size_t size, Littlefs2FileSystem& fileSystem, const std::nothrow_t&) noexcept
+{
+	assert(objectOffset + size <= sizeof(Littlefs2FileSystem::FileStorage));
+
+	const auto pool = fileSystem.buffers_.fileStorages != nullptr;
+	const auto storage = pool == true ? static_cast<void*>(fileSystem.allocateFileStorage()) :
+			::operator new(objectOffset + size, std::nothrow);
+	if (storage == nullptr)
+		return {};
+
+	*static_cast<Littlefs2FileSystem**>(storage) = pool == true ? &fileSystem : nullptr;
+	return static_cast<uint8_t*>(storage) + objectOffset;
+}
+
+void Littlefs2File::operator delete(void* const storage) noexcept
+{
+	if (storage == nullptr)
+		return;
+
+	const auto realStorage = static_cast<uint8_t*>(storage) - objectOffset;
+	const auto fileSystem = *reinterpret_cast<Littlefs2FileSystem**>(realStorage);
+	if (fileSystem == nullptr)
+	{
+		::operator delete(realStorage);
+		return;
+	}
+
+	const std::lock_guard<Littlefs2FileSystem> lockGuard {*fileSystem};
+	fileSystem->deallocateFileStorage(reinterpret_cast<const Littlefs2FileSystem::FileStorage*>(realStorage));
+}
+
+int Littlefs2File::allocate(const off_t offset, const off_t length)
+{
+	const std::lock_guard<Littlefs2File> lockGuard {*this};
+
+	assert(opened_ == true);
+
+	if (writable_ == false)
+		return EBADF;
+	if (offset < 0 || length <= 0)
+		return EINVAL;
+	if (length > LFS2_FILE_MAX - offset)
+		return EFBIG;
+
+	const auto size = lfs2_file_size(&fileSystem_.fileSystem_, &file_);
+	if (size < 0)
+		return littlefs2ErrorToErrorCode(size);
+
+	if (offset + length <= size)
+		return {};
+
+	const auto ret = lfs2_file_truncate(&fileSystem_.fileSystem_, &file_, offset + length);
+	return littlefs2ErrorToErrorCode(ret);
+}
+
 int Littlefs2File::close()
 {
 	const std::lock_guard<Littlefs2File> lockGuard {*this};
@@ -41,6 +112,7 @@ int Littlefs2File::close()
 
 	opened_ = {};
 	const auto ret = lfs2_file_close(&fileSystem_.fileSystem_, &file_);
+	fileSystem_.deallocateFileBuffer(fileConfiguration_.buffer);
 	return littlefs2ErrorToErrorCode(ret);
 }
 
@@ -125,9 +197,18 @@ int Littlefs2File::open(const char* const path, const int flags)
 	if ((flags & O_APPEND) != 0)
 		convertedFlags |= LFS2_O_APPEND;
 
-	const auto ret = lfs2_file_open(&fileSystem_.fileSystem_, &file_, path, convertedFlags);
+	const auto allocateRet = fileSystem_.allocateFileBuffer();
+	if (allocateRet.first != 0)
+		return allocateRet.first;
+
+	fileConfiguration_ = {};
+	fileConfiguration_.buffer = allocateRet.second;
+	const auto ret = lfs2_file_opencfg(&fileSystem_.fileSystem_, &file_, path, convertedFlags, &fileConfiguration_);
 	if (ret != LFS2_ERR_OK)
+	{
+		fileSystem_.deallocateFileBuffer(fileConfiguration_.buffer);
 		return littlefs2ErrorToErrorCode(ret);
+	}
 
 	opened_ = true;
 	return {};
@@ -2,7 +2,7 @@
  * \file
  * \brief Littlefs2File class header
  *
- * \author Copyright (C) 2019-2020 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2019-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,8 @@
 
 #include "distortos/FileSystem/File.hpp"
 
+#include <new>
+
 #include "lfs2.h"
 
 namespace distortos
@@ -39,6 +41,7 @@ public:
 
 	constexpr explicit Littlefs2File(Littlefs2FileSystem& fileSystem) :
 			file_{},
+			fileConfiguration_{},
 			fileSystem_{fileSystem},
 			opened_{},
 			readable_{},
@@ -55,6 +58,71 @@ public:
 
 	~Littlefs2File() override;
 
+	/**
+	 * \brief Allocates storage for Littlefs2File object.
+	 *
+	 * If the owner file system has a pool of storage for objects of opened files, the storage is taken from this pool,
+	 * otherwise it is allocated dynamically. Pointer to the file system which owns the pool (nullptr for dynamically
+	 * allocated storage) is placed before the object, so that the storage can be returned by operator delete.
+	 *
+	 * \pre Owner file system is locked.
+	 *
+	 * \param [in] size is the size of Littlefs2File object, bytes
+	 * \param [in] fileSystem is a reference to owner file system
+	 *
+	 * \return pointer to storage for Littlefs2File object, nullptr if all elements of the pool are in use or if
+	 * dynamic allocation failed
+	 */
+
+	static void* operator new(size_t size, Littlefs2FileSystem& fileSystem, const std::nothrow_t&) noexcept;
+
+	/**
+	 * \brief Deallocates storage for Littlefs2File object.
+	 *
+	 * The storage is returned to the pool of owner file system or deallocated dynamically.
+	 *
+	 * \param [in] storage is a pointer to storage for Littlefs2File object
+	 */
+
+	static void operator delete(void* storage) noexcept;
+
+	/**
+	 * \brief Deallocates storage for Littlefs2File object which was not constructed.
+	 *
+	 * \param [in] storage is a pointer to storage for Littlefs2File object
+	 */
+
+	static void operator delete(void* storage, Littlefs2FileSystem&, const std::nothrow_t&) noexcept
+	{
+		operator delete(storage);
+	}
+
+	/**
+	 * \brief Allocates space for file.
+	 *
+	 * Similar to [posix_fallocate()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/posix_fallocate.html)
+	 *
+	 * If the size of the file is less than \a offset + \a length, the file is extended to this size and the added part
+	 * is filled with zeros. As littlefs is a copy-on-write file system, this doesn't reserve space for later writes in
+	 * this range. Current file offset is not changed.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \pre %File is opened.
+	 *
+	 * \param [in] offset is the offset of the beginning of the range, bytes
+	 * \param [in] length is the length of the range, bytes
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - file is not opened for writing;
+	 * - EFBIG - \a offset + \a length is greater than max size of file;
+	 * - EINVAL - \a offset is less than 0 or \a length is not greater than 0;
+	 * - converted error codes returned by lfs2_file_size();
+	 * - converted error codes returned by lfs2_file_truncate();
+	 */
+
+	int allocate(off_t offset, off_t length) override;
+
 	/**
 	 * \brief Closes file.
 	 *
@@ -165,7 +233,8 @@ public:
 	 * [open()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/open.html)
 	 *
 	 * \return 0 on success, error code otherwise:
-	 * - converted error codes returned by lfs2_file_open();
+	 * - converted error codes returned by lfs2_file_opencfg();
+	 * - error codes returned by Littlefs2FileSystem::allocateFileBuffer();
 	 */
 
 	int open(const char* path, int flags);
@@ -277,6 +346,9 @@ private:
 	/// littlefs-v2 file
 	lfs2_file_t file_;
 
+	/// configuration of littlefs-v2 file
+	lfs2_file_config fileConfiguration_;
+
 	/// reference to owner file system
 	Littlefs2FileSystem& fileSystem_;
 
@@ -2,7 +2,7 @@
  * \file
  * \brief Littlefs2FileSystem class implementation
  *
- * \author Copyright (C) 2019-2022 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2019-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -22,6 +22,7 @@
 #include <mutex>
 
 #include <cassert>
+#include <climits>
 
 namespace distortos
 {
@@ -172,6 +173,7 @@ int littlefs2MemoryTechnologyDeviceSynchronize(const lfs2_config* const configur
 Littlefs2FileSystem::~Littlefs2FileSystem()
 {
 	assert(mounted_ == false);
+	assert(usedFileStorages_ == 0);
 }
 
 int Littlefs2FileSystem::format()
@@ -207,10 +209,13 @@ int Littlefs2FileSystem::format()
 	configuration_.block_cycles = blockCycles_;
 	configuration_.cache_size =
 			cacheSize_ != 0 ? cacheSize_ : std::max(configuration_.read_size, configuration_.prog_size);
-	configuration_.lookahead_size = (std::max(lookaheadSize_, 1u) + 63) / 64 * 64;
+	configuration_.lookahead_size = (std::max<size_t>(lookaheadSize_, 1) + 63) / 64 * 64;
 	configuration_.name_max = filenameLengthLimit_;
 	configuration_.file_max = fileSizeLimit_;
 	configuration_.attr_max = attributeSizeLimit_;
+	configuration_.read_buffer = buffers_.readBuffer;
+	configuration_.prog_buffer = buffers_.programBuffer;
+	configuration_.lookahead_buffer = buffers_.lookaheadBuffer;
 
 	const auto ret = lfs2_format(&fileSystem_, &configuration_);
 	return littlefs2ErrorToErrorCode(ret);
@@ -305,15 +310,19 @@ int Littlefs2FileSystem::mount()
 	configuration_.block_cycles = blockCycles_;
 	configuration_.cache_size =
 			cacheSize_ != 0 ? cacheSize_ : std::max(configuration_.read_size, configuration_.prog_size);
-	configuration_.lookahead_size = (std::max(lookaheadSize_, 1u) + 63) / 64 * 64;
+	configuration_.lookahead_size = (std::max<size_t>(lookaheadSize_, 1) + 63) / 64 * 64;
 	configuration_.name_max = filenameLengthLimit_;
 	configuration_.file_max = fileSizeLimit_;
 	configuration_.attr_max = attributeSizeLimit_;
+	configuration_.read_buffer = buffers_.readBuffer;
+	configuration_.prog_buffer = buffers_.programBuffer;
+	configuration_.lookahead_buffer = buffers_.lookaheadBuffer;
 
 	const auto ret = lfs2_mount(&fileSystem_, &configuration_);
 	if (ret != LFS2_ERR_OK)
 		return littlefs2ErrorToErrorCode(ret);
 
+	usedFileBuffers_ = {};
 	mounted_ = true;
 	closeScopeGuard.release();
 	return 0;
@@ -342,9 +351,9 @@ std::pair<int, std::unique_ptr<File>> Littlefs2FileSystem::openFile(const char*
 
 	assert(mounted_ == true);
 
-	std::unique_ptr<Littlefs2File> file {new (std::nothrow) Littlefs2File{*this}};
+	std::unique_ptr<Littlefs2File> file {new (*this, std::nothrow) Littlefs2File{*this}};
 	if (file == nullptr)
-		return {ENOMEM, std::unique_ptr<Littlefs2File>{}};
+		return {buffers_.fileStorages != nullptr ? EMFILE : ENOMEM, std::unique_ptr<Littlefs2File>{}};
 
 	const auto ret = file->open(path, flags);
 	if (ret != 0)
@@ -395,4 +404,62 @@ int Littlefs2FileSystem::unmount()
 	return unmountRet != LFS2_ERR_OK ? littlefs2ErrorToErrorCode(unmountRet) : closeRet;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, void*> Littlefs2FileSystem::allocateFileBuffer()
+{
+	assert(buffers_.fileBuffersCount <= sizeof(usedFileBuffers_) * CHAR_BIT);
+
+	if (buffers_.fileBuffers == nullptr)
+		return {{}, nullptr};
+
+	const auto freeFileBuffers = ~usedFileBuffers_;
+	if (freeFileBuffers == 0)
+		return {EMFILE, nullptr};
+
+	const auto index = static_cast<size_t>(__builtin_ctz(freeFileBuffers));
+	if (index >= buffers_.fileBuffersCount)
+		return {EMFILE, nullptr};
+
+	usedFileBuffers_ |= 1u << index;
+	return {{}, static_cast<uint8_t*>(buffers_.fileBuffers) + index * configuration_.cache_size};
+}
+
+void Littlefs2FileSystem::deallocateFileBuffer(const void* const fileBuffer)
+{
+	if (fileBuffer == nullptr)
+		return;
+
+	const size_t offset = static_cast<const uint8_t*>(fileBuffer) - static_cast<const uint8_t*>(buffers_.fileBuffers);
+	const auto index = offset / configuration_.cache_size;
+	assert(index < buffers_.fileBuffersCount && (usedFileBuffers_ & 1u << index) != 0);
+	usedFileBuffers_ &= ~(1u << index);
+}
+
+Littlefs2FileSystem::FileStorage* Littlefs2FileSystem::allocateFileStorage()
+{
+	assert(buffers_.fileStorages != nullptr);
+	assert(buffers_.fileBuffersCount <= sizeof(usedFileStorages_) * CHAR_BIT);
+
+	const auto freeFileStorages = ~usedFileStorages_;
+	if (freeFileStorages == 0)
+		return {};
+
+	const auto index = static_cast<size_t>(__builtin_ctz(freeFileStorages));
+	if (index >= buffers_.fileBuffersCount)
+		return {};
+
+	usedFileStorages_ |= 1u << index;
+	return buffers_.fileStorages + index;
+}
+
+void Littlefs2FileSystem::deallocateFileStorage(const FileStorage* const fileStorage)
+{
+	const auto index = static_cast<size_t>(fileStorage - buffers_.fileStorages);
+	assert(index < buffers_.fileBuffersCount && (usedFileStorages_ & 1u << index) != 0);
+	usedFileStorages_ &= ~(1u << index);
+}
+
 }	// namespace distortos
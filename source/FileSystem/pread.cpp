@@ -0,0 +1,79 @@
+/**
+ * \file
+ * \brief pread() implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_FILESYSTEMS_STANDARD_LIBRARY_INTEGRATION_ENABLE == 1
+
+#include "distortos/internal/FileSystem/fileDescriptions.hpp"
+
+#include "distortos/FileSystem/File.hpp"
+
+#include <unistd.h>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Reads data from file at given position, without changing file offset.
+ *
+ * See [pread()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/pread.html)
+ *
+ * \param [in] fileDescriptor is a descriptor of file that will be read
+ * \param [out] buffer is the buffer into which the data will be read, must be valid
+ * \param [in] size is the size of \a buffer, bytes
+ * \param [in] position is the position in file from which the data will be read, bytes
+ *
+ * \return non-negative number of bytes actually read on success, -1 otherwise; error codes (via errno):
+ * - EBADF - \a fileDescriptor is not a valid file descriptor opened for reading;
+ * - error codes returned by File::readAt();
+ */
+
+ssize_t pread(const int fileDescriptor, void* const buffer, const size_t size, const off_t position)
+{
+	if (fileDescriptor < 0 || static_cast<size_t>(fileDescriptor) >= fileDescriptions.size() ||
+			fileDescriptions[fileDescriptor] == nullptr)
+	{
+		errno = EBADF;
+		return -1;
+	}
+
+	int ret;
+	size_t bytesRead;
+	std::tie(ret, bytesRead) = fileDescriptions[fileDescriptor]->readAt(position, buffer, size);
+	if (bytesRead == 0 && ret != 0)
+	{
+		errno = ret;
+		return -1;
+	}
+
+	return bytesRead;
+}
+
+}	// extern "C"
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_FILESYSTEMS_STANDARD_LIBRARY_INTEGRATION_ENABLE == 1
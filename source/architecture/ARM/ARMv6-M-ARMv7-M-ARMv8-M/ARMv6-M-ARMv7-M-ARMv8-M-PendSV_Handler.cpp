@@ -2,16 +2,24 @@
  * \file
  * \brief PendSV_Handler() for ARMv6-M, ARMv7-M and ARMv8-M
  *
- * \author Copyright (C) 2014-2024 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "ARMv7-M-ARMv8-M-lazyFpuContextSwitch.hpp"
+
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#ifdef DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+#include "distortos/internal/synchronization/deliverZeroLatencyNotifications.hpp"
+
+#endif	// def DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 #ifdef DISTORTOS_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE
@@ -51,6 +59,9 @@ void checkStackPointerWrapper(const void* const stackPointer)
 /**
  * \brief Wrapper for void* distortos::internal::getScheduler().switchContext(void*)
  *
+ * If zero-latency notifications are enabled, pending notifications sent with ZeroLatencyNotification::notify() are
+ * delivered before the switch, so threads woken by them may be selected to run.
+ *
  * \param [in] stackPointer is the current value of current thread's stack pointer
  *
  * \return new thread's stack pointer
@@ -58,7 +69,25 @@ void checkStackPointerWrapper(const void* const stackPointer)
 
 void* schedulerSwitchContextWrapper(void* const stackPointer)
 {
+#ifdef DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+	internal::deliverZeroLatencyNotifications();
+
+#endif	// def DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+#ifdef DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+
+	auto& scheduler = internal::getScheduler();
+	architecture::saveFpuContext(scheduler.getCurrentThreadControlBlock(), stackPointer);
+	const auto newStackPointer = scheduler.switchContext(stackPointer);
+	architecture::restoreFpuContext(scheduler.getCurrentThreadControlBlock(), newStackPointer);
+	return newStackPointer;
+
+#else	// !def DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+
 	return internal::getScheduler().switchContext(stackPointer);
+
+#endif	// !def DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
 }
 
 }	// namespace
@@ -142,7 +171,11 @@ extern "C" __attribute__ ((naked)) void PendSV_Handler()
 #if __FPU_PRESENT == 1 && __FPU_USED == 1
 			"	tst			lr, #1 << 4							\n"	// was floating-point used by the thread?
 			"	it			eq									\n"
+#ifdef DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+			"	subeq		r0, r0, #0x40						\n"	// only reserve space for "floating-point" context
+#else	// !def DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
 			"	vstmdbeq	r0!, {s16-s31}						\n"	// save "floating-point" context of current thread
+#endif	// !def DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
 			// save "regular" context of current thread (r12 is saved just to keep double-word alignment)
 			"	stmdb		r0!, {r4-r12, lr}					\n"
 #else	// __FPU_PRESENT != 1 || __FPU_USED != 1
@@ -156,7 +189,11 @@ extern "C" __attribute__ ((naked)) void PendSV_Handler()
 			"	ldmia		r0!, {r4-r12, lr}					\n"	// load "regular" context of new thread
 			"	tst			lr, #1 << 4							\n"	// was floating-point used by the thread?
 			"	it			eq									\n"
+#ifdef DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+			"	addeq		r0, r0, #0x40						\n"	// "floating-point" context was already restored
+#else	// !def DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
 			"	vldmiaeq	r0!, {s16-s31}						\n"	// load "floating-point" context of new thread
+#endif	// !def DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
 #else	// __FPU_PRESENT != 1 || __FPU_USED != 1
 			"	mov			lr, r4								\n"
 			"	ldmia		r0!, {r4-r11}						\n"	// load context of new thread
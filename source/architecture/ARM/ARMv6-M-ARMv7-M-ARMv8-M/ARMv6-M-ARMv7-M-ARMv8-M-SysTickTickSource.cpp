@@ -0,0 +1,85 @@
+/**
+ * \file
+ * \brief SysTickTickSource class implementation for ARMv6-M, ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ARMv6-M-ARMv7-M-ARMv8-M-SysTickTickSource.hpp"
+
+#include "distortos/chip/clocks.hpp"
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets number of SysTick cycles which passed since SysTick counter reached zero.
+ *
+ * \param [in] reload is the value of SysTick's LOAD register
+ *
+ * \return number of SysTick cycles which passed since SysTick counter reached zero, [0; \a reload]
+ */
+
+uint32_t getSysTickCycles(const uint32_t reload)
+{
+	const uint32_t value {SysTick->VAL};
+	return value == 0 ? 0 : reload + 1 - value;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::chrono::nanoseconds SysTickTickSource::getTimeSinceTick() const
+{
+	const uint32_t reload {SysTick->LOAD};
+	uint64_t cycles {getSysTickCycles(reload)};
+	// if tick interrupt is pending, the counter may have been reloaded after it was read - read it again
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+		cycles = getSysTickCycles(reload) + reload + 1;
+
+	// SysTick is clocked either with AHB clock or with AHB clock divided by 8
+	if ((SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk) == 0)
+		cycles *= 8;
+
+	constexpr uint64_t nanosecondsPerSecond {1000000000};
+	return std::chrono::nanoseconds{cycles * nanosecondsPerSecond / chip::ahbFrequency};
+}
+
+void SysTickTickSource::start()
+{
+	// lowest possible priority
+	NVIC_SetPriority(SysTick_IRQn, 0xff);
+
+	constexpr uint32_t period {chip::ahbFrequency / DISTORTOS_TICK_FREQUENCY};
+	constexpr uint32_t periodDividedBy8 {period / 8};
+	constexpr uint32_t maxSysTickPeriod {1 << 24};
+	constexpr bool divideBy8 {period > maxSysTickPeriod};
+	// at least one of the periods must be valid
+	static_assert(period <= maxSysTickPeriod || periodDividedBy8 <= maxSysTickPeriod, "Invalid SysTick configuration!");
+	SysTick->LOAD = (divideBy8 == false ? period : periodDividedBy8) - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL = (divideBy8 == true ? 0 : SysTick_CTRL_CLKSOURCE_Msk) | SysTick_CTRL_ENABLE_Msk |
+			SysTick_CTRL_TICKINT_Msk;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief SysTickTickSource class header for ARMv6-M, ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV8_M_ARMV6_M_ARMV7_M_ARMV8_M_SYSTICKTICKSOURCE_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV8_M_ARMV6_M_ARMV7_M_ARMV8_M_SYSTICKTICKSOURCE_HPP_
+
+#include "distortos/TickSource.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// SysTickTickSource class is the default tick source for ARMv6-M, ARMv7-M and ARMv8-M, which uses SysTick timer
+class SysTickTickSource : public TickSource
+{
+public:
+
+	/**
+	 * \brief SysTickTickSource's constructor
+	 */
+
+	constexpr SysTickTickSource()
+	{
+
+	}
+
+	/**
+	 * \brief Gets time which passed since last tick.
+	 *
+	 * \return time which passed since last tick which was handled with handleTick()
+	 */
+
+	std::chrono::nanoseconds getTimeSinceTick() const override;
+
+	/**
+	 * \brief Starts generation of ticks with DISTORTOS_TICK_FREQUENCY.
+	 *
+	 * Configures SysTick timer with lowest possible interrupt priority.
+	 */
+
+	void start() override;
+};
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV8_M_ARMV6_M_ARMV7_M_ARMV8_M_SYSTICKTICKSOURCE_HPP_
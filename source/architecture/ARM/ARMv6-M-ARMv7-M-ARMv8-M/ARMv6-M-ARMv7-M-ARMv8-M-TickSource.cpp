@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief TickSource::handleTick() for ARMv6-M, ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/TickSource.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/requestContextSwitch.hpp"
+
+#ifdef DISTORTOS_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/FATAL_ERROR.h"
+
+#endif	// def DISTORTOS_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public static functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void TickSource::handleTick()
+{
+	auto& scheduler = internal::getScheduler();
+
+#ifdef DISTORTOS_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+	const auto stackPointer = reinterpret_cast<const void*>(__get_PSP());
+	if (scheduler.getCurrentThreadControlBlock().getStack().checkStackPointer(stackPointer) == false)
+		FATAL_ERROR("Stack overflow detected!");
+
+#endif	// def DISTORTOS_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+	const auto contextSwitchRequired = scheduler.tickInterruptHandler();
+	if (contextSwitchRequired == true)
+		architecture::requestContextSwitch();
+}
+
+}	// namespace distortos
@@ -9,6 +9,9 @@
  * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "ARMv7-M-ARMv8-M-interruptMaskingStatistics.hpp"
+#include "ARMv7-M-ARMv8-M-lazyFpuContextSwitch.hpp"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 #include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
@@ -40,6 +43,17 @@ void architectureLowLevelInitializer()
 #if __FPU_PRESENT == 1 && __FPU_USED == 1
 	SCB->CPACR |= 3 << 10 * 2 | 3 << 11 * 2;	// full access to CP10 and CP11
 #endif	// __FPU_PRESENT == 1 && __FPU_USED == 1
+#ifdef DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+	// NOCP usage fault is used to detect first use of floating-point unit after context switch
+	NVIC_SetPriority(UsageFault_IRQn, 0);
+	SCB->SHCSR |= SCB_SHCSR_USGFAULTENA_Msk;
+#endif	// def DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+#ifdef DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+	// DWT cycle counter is used to measure duration of sections with masked interrupts
+	DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif	// def DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
 }
 
 BIND_LOW_LEVEL_INITIALIZER(30, architectureLowLevelInitializer);
@@ -11,6 +11,8 @@
 
 #include "distortos/architecture/disableInterruptMasking.hpp"
 
+#include "ARMv7-M-ARMv8-M-interruptMaskingStatistics.hpp"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 namespace distortos
@@ -25,6 +27,11 @@ namespace architecture
 
 InterruptMask disableInterruptMasking()
 {
+#ifdef DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+	if (isInterruptMaskingEnabled(getInterruptMask()) == true)
+		endInterruptMaskingSection(__builtin_return_address(0));
+#endif	// def DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+
 #if DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI != 0
 
 	const auto interruptMask = __get_BASEPRI();
@@ -11,6 +11,8 @@
 
 #include "distortos/architecture/enableInterruptMasking.hpp"
 
+#include "ARMv7-M-ARMv8-M-interruptMaskingStatistics.hpp"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 namespace distortos
@@ -42,15 +44,19 @@ InterruptMask enableInterruptMasking()
 	__enable_irq();	// ARM Cortex-M7 r0p1 bug ID 837070
 #endif	// def DISTORTOS_ARCHITECTURE_ARM_CORTEX_M7_R0P1
 
-	return interruptMask;
-
 #else	// DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI == 0
 
 	const auto interruptMask = __get_PRIMASK();
 	__disable_irq();
-	return interruptMask;
 
 #endif	// DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI == 0
+
+#ifdef DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+	if (isInterruptMaskingEnabled(interruptMask) == false)
+		beginInterruptMaskingSection(__builtin_return_address(0));
+#endif	// def DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+
+	return interruptMask;
 }
 
 }	// namespace architecture
@@ -0,0 +1,46 @@
+/**
+ * \file
+ * \brief Default getTickSource() for ARMv6-M, ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ARMv6-M-ARMv7-M-ARMv8-M-SysTickTickSource.hpp"
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// default tick source - SysTick timer
+architecture::SysTickTickSource sysTickTickSource;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Default getTickSource() for ARMv6-M, ARMv7-M and ARMv8-M
+ *
+ * Weak definition, which may be overridden by board or application.
+ *
+ * \return reference to SysTick tick source
+ */
+
+__attribute__ ((weak)) TickSource& getTickSource()
+{
+	return sysTickTickSource;
+}
+
+}	// namespace distortos
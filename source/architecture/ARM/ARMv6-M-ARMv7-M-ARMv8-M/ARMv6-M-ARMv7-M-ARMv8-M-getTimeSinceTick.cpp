@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief getTimeSinceTick() implementation for ARMv6-M, ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getTimeSinceTick.hpp"
+
+#include "distortos/TickSource.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::chrono::nanoseconds getTimeSinceTick()
+{
+	return getTickSource().getTimeSinceTick();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -19,6 +19,7 @@
 #include "ARMv7-M-ARMv8-M-ExceptionFpuStackFrame.hpp"
 #endif	// __FPU_PRESENT == 1 && __FPU_USED == 1
 
+#include "ARMv7-M-ARMv8-M-lazyFpuContextSwitch.hpp"
 #include "ARMv6-M-ARMv7-M-ARMv8-M-StackFrame.hpp"
 #include "ARMv6-M-ARMv7-M-ARMv8-M-supervisorCall.hpp"
 
@@ -254,6 +255,11 @@ int fromInterruptToCurrentThread(internal::ThreadControlBlock& threadControlBloc
 
 int toNonCurrentThread(internal::ThreadControlBlock& threadControlBlock, void (& function)())
 {
+#ifdef DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+	// trampoline loads "floating-point" context of the thread from its stack, so it must be saved there
+	flushFpuContext();
+#endif	// def DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+
 	auto& stack = threadControlBlock.getStack();
 	const auto stackPointer = stack.getStackPointer();
 	const auto stackFrame = reinterpret_cast<StackFrame*>(stackPointer) - 1;
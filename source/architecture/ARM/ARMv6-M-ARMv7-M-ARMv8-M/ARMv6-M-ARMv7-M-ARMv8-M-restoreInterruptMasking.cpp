@@ -11,6 +11,8 @@
 
 #include "distortos/architecture/restoreInterruptMasking.hpp"
 
+#include "ARMv7-M-ARMv8-M-interruptMaskingStatistics.hpp"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 namespace distortos
@@ -25,6 +27,13 @@ namespace architecture
 
 void restoreInterruptMasking(const InterruptMask interruptMask)
 {
+#ifdef DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+	const auto wasEnabled = isInterruptMaskingEnabled(getInterruptMask());
+	const auto willBeEnabled = isInterruptMaskingEnabled(interruptMask);
+	if (wasEnabled == true && willBeEnabled == false)
+		endInterruptMaskingSection(__builtin_return_address(0));
+#endif	// def DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+
 #if DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI != 0
 
 #ifdef DISTORTOS_ARCHITECTURE_ARM_CORTEX_M7_R0P1
@@ -42,6 +51,11 @@ void restoreInterruptMasking(const InterruptMask interruptMask)
 	__set_PRIMASK(interruptMask);
 
 #endif	// DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI == 0
+
+#ifdef DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+	if (wasEnabled == false && willBeEnabled == true)
+		beginInterruptMaskingSection(__builtin_return_address(0));
+#endif	// def DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
 }
 
 }	// namespace architecture
@@ -0,0 +1,59 @@
+/**
+ * \file
+ * \brief Implementation of interrupt masking statistics functions for ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ARMv7-M-ARMv8-M-interruptMaskingStatistics.hpp"
+
+#ifdef DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+
+#include "distortos/internal/scheduler/recordInterruptMaskingSection.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// address of code which masked interrupts in current section
+const void* maskingAddress_;
+
+/// value of DWT cycle counter at the beginning of current section
+uint32_t maskingCycleCount_;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void beginInterruptMaskingSection(const void* const maskingAddress)
+{
+	maskingAddress_ = maskingAddress;
+	maskingCycleCount_ = DWT->CYCCNT;
+}
+
+void endInterruptMaskingSection(const void* const unmaskingAddress)
+{
+	const uint32_t duration = DWT->CYCCNT - maskingCycleCount_;
+	internal::recordInterruptMaskingSection(maskingAddress_, unmaskingAddress, duration);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
@@ -0,0 +1,84 @@
+/**
+ * \file
+ * \brief Header with interrupt masking statistics functions for ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV8_M_ARMV7_M_ARMV8_M_INTERRUPTMASKINGSTATISTICS_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV8_M_ARMV7_M_ARMV8_M_INTERRUPTMASKINGSTATISTICS_HPP_
+
+#include "distortos/architecture/InterruptMask.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#if defined(DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE) && defined(DWT_CTRL_CYCCNTENA_Msk)
+
+/// interrupt masking statistics are enabled and supported by the chip
+#define DISTORTOS_ARCHITECTURE_INTERRUPT_MASKING_STATISTICS
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Marks the beginning of section with masked interrupts.
+ *
+ * \attention This function must be called right after interrupts are masked.
+ *
+ * \param [in] maskingAddress is the address of code which masked interrupts
+ */
+
+void beginInterruptMaskingSection(const void* maskingAddress);
+
+/**
+ * \brief Marks the end of section with masked interrupts and records it in interrupt masking statistics.
+ *
+ * \attention This function must be called right before interrupts are unmasked.
+ *
+ * \param [in] unmaskingAddress is the address of code which unmasks interrupts
+ */
+
+void endInterruptMaskingSection(const void* unmaskingAddress);
+
+/**
+ * \return current value of interrupts' mask
+ */
+
+inline InterruptMask getInterruptMask()
+{
+#if DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI != 0
+	return __get_BASEPRI();
+#else	// DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI == 0
+	return __get_PRIMASK();
+#endif	// DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI == 0
+}
+
+/**
+ * \param [in] interruptMask is the value of interrupts' mask
+ *
+ * \return true if \a interruptMask masks interrupts which may use kernel's functions, false otherwise
+ */
+
+constexpr bool isInterruptMaskingEnabled(const InterruptMask interruptMask)
+{
+#if DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI != 0
+	return interruptMask != 0 && interruptMask <= DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI << (8 - __NVIC_PRIO_BITS);
+#else	// DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI == 0
+	return interruptMask != 0;
+#endif	// DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI == 0
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// defined(DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE) && defined(DWT_CTRL_CYCCNTENA_Msk)
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV8_M_ARMV7_M_ARMV8_M_INTERRUPTMASKINGSTATISTICS_HPP_
@@ -0,0 +1,204 @@
+/**
+ * \file
+ * \brief Implementation of lazy context switch of floating-point unit for ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ARMv7-M-ARMv8-M-lazyFpuContextSwitch.hpp"
+
+#ifdef DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+
+#include "ARMv6-M-ARMv7-M-ARMv8-M-SoftwareStackFrame.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/FATAL_ERROR.h"
+
+static_assert(DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI != 0,
+		"Lazy context switch of floating-point unit requires interrupt masking with BASEPRI!");
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// full access to CP10 and CP11 in CPACR register
+constexpr uint32_t cpacrFpuFullAccess {3 << 10 * 2 | 3 << 11 * 2};
+
+/// bit of exception return value which is cleared when floating-point context is active
+constexpr uintptr_t exceptionReturnFpuContextInactive {1 << 4};
+
+/// space for s16-s31 registers in the stack of the thread which owns the registers of floating-point unit, nullptr if
+/// the registers are not owned by any thread which is not running
+void* fpuOwnerContext;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \param [in] softwareStackFrame is a reference to SoftwareStackFrame of thread
+ *
+ * \return true if the thread has active context of floating-point unit, false otherwise
+ */
+
+bool hasFpuContext(const SoftwareStackFrame& softwareStackFrame)
+{
+	return (reinterpret_cast<uintptr_t>(softwareStackFrame.exceptionReturn) & exceptionReturnFpuContextInactive) == 0;
+}
+
+/**
+ * \brief Loads s16-s31 registers.
+ *
+ * The only argument - a pointer to saved values of s16-s31 registers - is passed in r0. The argument is not named, as
+ * only basic asm can be used in naked function.
+ */
+
+__attribute__ ((naked)) void loadFpuRegisters(const void*)
+{
+	asm volatile
+	(
+			"	vldmia		r0, {s16-s31}				\n"
+			"	bx			lr							\n"
+	);
+}
+
+/**
+ * \brief Saves s16-s31 registers in the stack of thread which owns them (if any).
+ *
+ * If stacking of s0-s15 and FPSCR registers of this thread is still pending, the first floating-point instruction
+ * executed here triggers it, so after this function returns whole context of the thread is saved in its stack.
+ *
+ * \attention Access to floating-point unit must be enabled.
+ */
+
+void saveFpuOwnerContext()
+{
+	if (fpuOwnerContext == nullptr)
+		return;
+
+	asm volatile ("	vstmia	%[context], {s16-s31}" :: [context] "r" (fpuOwnerContext) : "memory");
+	fpuOwnerContext = nullptr;
+}
+
+/**
+ * \brief Enables or disables access to floating-point unit.
+ *
+ * \param [in] enable selects whether access to floating-point unit is enabled (true) or disabled (false)
+ */
+
+void setFpuAccess(const bool enable)
+{
+	const auto cpacr = SCB->CPACR;
+	const auto newCpacr = enable == true ? cpacr | cpacrFpuFullAccess : cpacr & ~cpacrFpuFullAccess;
+	if (newCpacr == cpacr)
+		return;
+
+	SCB->CPACR = newCpacr;
+	__DSB();
+	__ISB();
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void flushFpuContext()
+{
+	if (fpuOwnerContext == nullptr)
+		return;
+
+	setFpuAccess(true);
+	saveFpuOwnerContext();
+	setFpuAccess(internal::getScheduler().getCurrentThreadControlBlock().isFpuFree() == false);
+}
+
+void restoreFpuContext(const internal::ThreadControlBlock& threadControlBlock, const void* const stackPointer)
+{
+	const auto softwareStackFrame = static_cast<const SoftwareStackFrame*>(stackPointer);
+	if (hasFpuContext(*softwareStackFrame) == false)
+	{
+		// block access if the registers must be protected, first use of floating-point unit will be detected
+		setFpuAccess(fpuOwnerContext == nullptr && threadControlBlock.isFpuFree() == false);
+		return;
+	}
+
+	setFpuAccess(true);
+	const auto context = softwareStackFrame + 1;
+	if (context != fpuOwnerContext)	// registers hold context of another thread or no context at all?
+	{
+		saveFpuOwnerContext();
+		loadFpuRegisters(context);
+	}
+	// otherwise s16-s31 still hold values of this thread; s0-s15 and FPSCR are either also still in the registers or
+	// were stacked by the hardware - in both cases exception return will handle them properly
+
+	fpuOwnerContext = nullptr;
+}
+
+void saveFpuContext(const internal::ThreadControlBlock& threadControlBlock, void* const stackPointer)
+{
+	const auto softwareStackFrame = static_cast<SoftwareStackFrame*>(stackPointer);
+	if (hasFpuContext(*softwareStackFrame) == false)
+		return;
+
+	if (threadControlBlock.isFpuFree() == true)
+		FATAL_ERROR("Floating-point unit used by FPU-free thread!");
+
+	if (threadControlBlock.getState() == ThreadState::terminated)
+	{
+		// context of terminated thread will never be restored, so drop pending stacking of its s0-s15 and FPSCR
+		FPU->FPCCR &= ~FPU_FPCCR_LSPACT_Msk;
+		return;
+	}
+
+	fpuOwnerContext = softwareStackFrame + 1;
+}
+
+/**
+ * \brief UsageFault_Handler() for ARMv7-M and ARMv8-M with lazy context switch of floating-point unit
+ *
+ * Handles NOCP usage fault, which is caused by the first use of floating-point unit after access to it was blocked
+ * during context switch. Registers of floating-point unit are saved in the stack of the thread which owns them and
+ * access is enabled, so the faulting instruction can be executed again. All other usage faults are not handled, just
+ * like in the default handler.
+ */
+
+extern "C" void UsageFault_Handler()
+{
+	// not a NOCP usage fault or access to floating-point unit is not blocked?
+	if ((SCB->CFSR & SCB_CFSR_NOCP_Msk) == 0 || (SCB->CPACR & cpacrFpuFullAccess) == cpacrFpuFullAccess)
+		while (1);
+
+	SCB->CFSR = SCB_CFSR_NOCP_Msk;
+
+	// usage fault was caused by thread (no other exception was preempted) which was declared as FPU-free?
+	if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) != 0 &&
+			internal::getScheduler().getCurrentThreadControlBlock().isFpuFree() == true)
+		FATAL_ERROR("Floating-point unit used by FPU-free thread!");
+
+	setFpuAccess(true);
+	saveFpuOwnerContext();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
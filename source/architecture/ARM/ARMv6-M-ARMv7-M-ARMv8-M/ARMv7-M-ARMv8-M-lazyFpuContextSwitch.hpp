@@ -0,0 +1,80 @@
+/**
+ * \file
+ * \brief Header with functions used for lazy context switch of floating-point unit for ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV8_M_ARMV7_M_ARMV8_M_LAZYFPUCONTEXTSWITCH_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV8_M_ARMV7_M_ARMV8_M_LAZYFPUCONTEXTSWITCH_HPP_
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#if defined(DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE) && __FPU_PRESENT == 1 && __FPU_USED == 1
+
+/// lazy context switch of floating-point unit is enabled and supported by the chip
+#define DISTORTOS_ARCHITECTURE_LAZY_FPU_CONTEXT_SWITCH
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadControlBlock;
+
+}	// namespace internal
+
+namespace architecture
+{
+
+/**
+ * \brief Saves context of floating-point unit which was left in its registers by a thread that is not running.
+ *
+ * This function must be called before the saved context of a thread which is not running is accessed by software.
+ *
+ * \attention This function must be called with enabled interrupt masking.
+ */
+
+void flushFpuContext();
+
+/**
+ * \brief Restores context of floating-point unit of thread which is switched in.
+ *
+ * If the thread has active context of floating-point unit, registers s16-s31 are loaded from its stack, unless they
+ * still hold the values of this thread. Otherwise access to floating-point unit is blocked if another thread owns its
+ * registers or if the thread was declared as FPU-free.
+ *
+ * \attention This function should be called only by PendSV_Handler(), after Scheduler::switchContext().
+ *
+ * \param [in] threadControlBlock is a reference to ThreadControlBlock of thread which is switched in
+ * \param [in] stackPointer is the stack pointer of thread which is switched in, pointing to its SoftwareStackFrame
+ */
+
+void restoreFpuContext(const internal::ThreadControlBlock& threadControlBlock, const void* stackPointer);
+
+/**
+ * \brief Lazily saves context of floating-point unit of thread which is switched out.
+ *
+ * Registers s16-s31 are not saved - space for them is reserved in the stack and the thread becomes the owner of the
+ * registers. They are actually saved only when another thread or interrupt handler needs floating-point unit.
+ *
+ * \attention This function should be called only by PendSV_Handler(), before Scheduler::switchContext().
+ *
+ * \param [in] threadControlBlock is a reference to ThreadControlBlock of thread which is switched out
+ * \param [in] stackPointer is the stack pointer of thread which is switched out, pointing to its SoftwareStackFrame
+ */
+
+void saveFpuContext(const internal::ThreadControlBlock& threadControlBlock, void* stackPointer);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// defined(DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE) && __FPU_PRESENT == 1 && __FPU_USED == 1
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV8_M_ARMV7_M_ARMV8_M_LAZYFPUCONTEXTSWITCH_HPP_
@@ -15,7 +15,10 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-architectureLowLevelInitializer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-disableInterruptMasking.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-enableInterruptMasking.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-getInterruptStack.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-getMainStack.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-getTickSource.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-getTimeSinceTick.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-initializeStack.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-isInInterruptContext.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-PendSV_Handler.cpp
@@ -26,7 +29,11 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-startScheduling.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-supervisorCall.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-SVC_Handler.cpp
-		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-SysTick_Handler.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-SysTick_Handler.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-SysTickTickSource.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-TickSource.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv7-M-ARMv8-M-interruptMaskingStatistics.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv7-M-ARMv8-M-lazyFpuContextSwitch.cpp)
 
 doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR}
 		INCLUDE_PATH ${CMAKE_CURRENT_LIST_DIR}/include ${CMAKE_CURRENT_LIST_DIR}/external/CMSIS
@@ -142,6 +142,20 @@ void SdMmcCardLowLevel::interruptHandler()
 		dmaChannelHandle_.stopTransfer();
 	}
 
+	// next segment of gathered write transfer pending and transaction successful so far?
+	if (writeTransferPending == false && writeSegments_.size() != 0 &&
+			result == devices::SdMmcCardBase::Result::success)
+	{
+		// the card keeps receiving blocks of multi block write until it is stopped, so each segment is sent as a
+		// separate data transfer
+		const auto segment = *writeSegments_.begin();
+		writeSegments_ = {writeSegments_.begin() + 1, writeSegments_.end()};
+		startDmaTransfer(segment.buffer, segment.size, true);
+		sdmmcPeripheral_.writeDlen(segment.size);
+		sdmmcPeripheral_.writeDctrl(dctrl);
+		return;
+	}
+
 	// write transfer pending and transaction successful so far?
 	if (writeTransferPending == true && result == devices::SdMmcCardBase::Result::success)
 	{
@@ -152,6 +166,7 @@ void SdMmcCardLowLevel::interruptHandler()
 	}
 
 	sdmmcPeripheral_.writeMask({});
+	writeSegments_ = {};
 
 	if (response_.size() != 0)
 	{
@@ -208,31 +223,22 @@ void SdMmcCardLowLevel::startTransaction(devices::SdMmcCardBase& sdMmcCardBase,
 		assert(transfer.getBlockSize() == 1u << dblocksize);
 		assert(dblocksize <= 14);
 
-		const auto dlen = transfer.getSize();
 		assert(transfer.getSize() % transfer.getBlockSize() == 0);
-		assert(dlen <= SDMMC_DLEN_DATALENGTH >> SDMMC_DLEN_DATALENGTH_Pos);
+		assert(transfer.getSize() <= SDMMC_DLEN_DATALENGTH >> SDMMC_DLEN_DATALENGTH_Pos);
+
+		const auto writeSegments = transfer.getWriteSegments();
+		const auto dlen = writeSegments.size() == 0 ? transfer.getSize() : writeSegments.begin()->size;
+		assert(dlen != 0 && dlen % transfer.getBlockSize() == 0);
 
 		const auto dtimer = static_cast<uint64_t>((clockFrequency_ + 1000 - 1) / 1000) * transfer.getTimeoutMs();
 		assert(dtimer <= SDMMC_DTIMER_DATATIME >> SDMMC_DTIMER_DATATIME_Pos);
 
 		dmaError_ = {};
+		writeSegments_ = writeSegments.size() == 0 ? devices::WriteSegmentsRange{} :
+				devices::WriteSegmentsRange{writeSegments.begin() + 1, writeSegments.end()};
 
-		{
-			const auto memoryAddress = reinterpret_cast<uintptr_t>(transfer.isWriteTransfer() == false ?
-					transfer.getReadBuffer() : transfer.getWriteBuffer());
-			const auto directionFlags = transfer.isWriteTransfer() == false ? DmaChannel::Flags::peripheralToMemory :
-					DmaChannel::Flags::memoryToPeripheral;
-			dmaChannelHandle_.startTransfer(memoryAddress,
-					sdmmcPeripheral_.getFifoAddress(), transfer.getSize() / 4,
-					DmaChannel::Flags::transferCompleteInterruptDisable |
-					DmaChannel::Flags::peripheralFlowController |
-					directionFlags |
-					DmaChannel::Flags::peripheralFixed |
-					DmaChannel::Flags::memoryIncrement |
-					DmaChannel::Flags::veryHighPriority |
-					DmaChannel::Flags::dataSize4 |
-					DmaChannel::Flags::burstSize4);
-		}
+		startDmaTransfer(transfer.isWriteTransfer() == false ? transfer.getReadBuffer() : transfer.getWriteBuffer(), dlen,
+				transfer.isWriteTransfer());
 
 		sdmmcPeripheral_.writeDtimer(dtimer);
 		sdmmcPeripheral_.writeDlen(dlen);
@@ -282,6 +288,21 @@ void SdMmcCardLowLevel::stop()
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+void SdMmcCardLowLevel::startDmaTransfer(const void* const buffer, const size_t size, const bool writeTransfer)
+{
+	const auto directionFlags = writeTransfer == false ? DmaChannel::Flags::peripheralToMemory :
+			DmaChannel::Flags::memoryToPeripheral;
+	dmaChannelHandle_.startTransfer(reinterpret_cast<uintptr_t>(buffer), sdmmcPeripheral_.getFifoAddress(), size / 4,
+			DmaChannel::Flags::transferCompleteInterruptDisable |
+			DmaChannel::Flags::peripheralFlowController |
+			directionFlags |
+			DmaChannel::Flags::peripheralFixed |
+			DmaChannel::Flags::memoryIncrement |
+			DmaChannel::Flags::veryHighPriority |
+			DmaChannel::Flags::dataSize4 |
+			DmaChannel::Flags::burstSize4);
+}
+
 void SdMmcCardLowLevel::transferErrorEventHandler(size_t)
 {
 	dmaError_ = true;
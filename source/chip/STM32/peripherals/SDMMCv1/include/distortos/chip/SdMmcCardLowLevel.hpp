@@ -52,6 +52,7 @@ public:
 					response_{},
 					sdMmcCardBase_{},
 					sdmmcPeripheral_{sdmmcPeripheral},
+					writeSegments_{},
 					dmaError_{},
 					dmaRequest_{dmaRequest}
 	{
@@ -197,6 +198,16 @@ private:
 		return sdMmcCardBase_ != nullptr;
 	}
 
+	/**
+	 * \brief Starts DMA transfer between memory and SDMMC's FIFO.
+	 *
+	 * \param [in] buffer is the buffer in memory
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] writeTransfer selects whether this is a read (false) or write (true) transfer
+	 */
+
+	void startDmaTransfer(const void* buffer, size_t size, bool writeTransfer);
+
 	/**
 	 * \brief "Transfer error" event handler
 	 *
@@ -226,6 +237,9 @@ private:
 	/// reference to raw SDMMC peripheral
 	const SdmmcPeripheral& sdmmcPeripheral_;
 
+	/// range of segments of gathered write transfer which were not started yet
+	devices::WriteSegmentsRange writeSegments_;
+
 	/// true if DMA error was detected, false otherwise
 	volatile bool dmaError_;
 
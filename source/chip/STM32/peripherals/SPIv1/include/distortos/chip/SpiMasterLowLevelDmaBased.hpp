@@ -17,6 +17,8 @@
 
 #include "distortos/devices/communication/SpiMasterLowLevel.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
 namespace distortos
 {
 
@@ -28,7 +30,10 @@ class SpiPeripheral;
 /**
  * \brief SpiMasterLowLevelDmaBased class is a low-level SPI master driver for SPIv1 in STM32.
  *
- * This driver uses DMA for data transfers.
+ * This driver uses DMA for data transfers. Transfers which are not longer than configured threshold are executed by
+ * polling the peripheral, as for such short transfers the cost of configuring both DMA channels and handling the DMA
+ * interrupt is higher than the time needed to transfer the data. Such transfers are finished before startTransfer()
+ * returns.
  *
  * \ingroup devices
  */
@@ -45,10 +50,13 @@ public:
 	 * \param [in] rxDmaRequest is the request identifier for DMA channel used for reception
 	 * \param [in] txDmaChannel is a reference to DMA channel used for transmission
 	 * \param [in] txDmaRequest is the request identifier for DMA channel used for transmission
+	 * \param [in] pollingThreshold is the size of longest transfer which is executed by polling the peripheral instead
+	 * of using DMA, bytes, 0 to use DMA for all transfers, default - DISTORTOS_CHIP_SPI_POLLING_THRESHOLD
 	 */
 
 	constexpr SpiMasterLowLevelDmaBased(const SpiPeripheral& spiPeripheral, DmaChannel& rxDmaChannel,
-			const uint8_t rxDmaRequest, DmaChannel& txDmaChannel, const uint8_t txDmaRequest) :
+			const uint8_t rxDmaRequest, DmaChannel& txDmaChannel, const uint8_t txDmaRequest,
+			const size_t pollingThreshold = DISTORTOS_CHIP_SPI_POLLING_THRESHOLD) :
 					spiPeripheral_{spiPeripheral},
 					rxDmaChannel_{rxDmaChannel},
 					txDmaChannel_{txDmaChannel},
@@ -57,6 +65,7 @@ public:
 					rxDmaChannelFunctor_{*this},
 					txDmaChannelFunctor_{*this},
 					spiMasterBase_{},
+					pollingThreshold_{pollingThreshold},
 					rxDummyData_{},
 					txDummyData_{},
 					rxDmaRequest_{rxDmaRequest},
@@ -110,6 +119,9 @@ public:
 	 * This function returns immediately. When the transfer is physically finished (either expected number of bytes were
 	 * written and read or an error was detected), SpiMasterBase::transferCompleteEvent() will be executed.
 	 *
+	 * If \a size is not greater than polling threshold, the transfer is executed by polling the peripheral and
+	 * SpiMasterBase::transferCompleteEvent() is executed before this function returns.
+	 *
 	 * \pre Driver is started.
 	 * \pre No transfer is in progress.
 	 * \pre \a size is valid.
@@ -240,6 +252,18 @@ private:
 		return spiMasterBase_ != nullptr;
 	}
 
+	/**
+	 * \brief Executes transfer by polling the peripheral.
+	 *
+	 * Each word is written only after the previous one was read, so the transfer may be safely preempted at any point.
+	 *
+	 * \param [in] writeBuffer is the buffer with data that will be written, nullptr to send dummy data
+	 * \param [out] readBuffer is the buffer with data that will be read, nullptr to ignore received data
+	 * \param [in] size is the size of transfer (size of \a writeBuffer and/or \a readBuffer), bytes
+	 */
+
+	void pollTransfer(const void* writeBuffer, void* readBuffer, size_t size) const;
+
 	/// reference to raw SPI peripheral
 	const SpiPeripheral& spiPeripheral_;
 
@@ -264,6 +288,9 @@ private:
 	/// pointer to SpiMasterBase object associated with this one
 	devices::SpiMasterBase* volatile spiMasterBase_;
 
+	/// size of longest transfer which is executed by polling the peripheral, bytes
+	size_t pollingThreshold_;
+
 	/// object used as reception DMA target if read buffer of transfer is nullptr
 	uint16_t rxDummyData_;
 
@@ -85,6 +85,13 @@ void SpiMasterLowLevelDmaBased::startTransfer(devices::SpiMasterBase& spiMasterB
 	const auto dataSize = (wordLength_ + 8 - 1) / 8;
 	assert(size != 0 && size % dataSize == 0);
 
+	if (size <= pollingThreshold_)
+	{
+		pollTransfer(writeBuffer, readBuffer, size);
+		spiMasterBase.transferCompleteEvent(true);
+		return;
+	}
+
 	spiMasterBase_ = &spiMasterBase;
 
 	const auto transactions = size / dataSize;
@@ -140,6 +147,39 @@ void SpiMasterLowLevelDmaBased::eventHandler(const bool success)
 	spiMasterBase->transferCompleteEvent(success);
 }
 
+void SpiMasterLowLevelDmaBased::pollTransfer(const void* const writeBuffer, void* const readBuffer,
+		const size_t size) const
+{
+	const auto dataSize = (wordLength_ + 8 - 1) / 8;
+	const auto writeCharacters = static_cast<const uint8_t*>(writeBuffer);
+	const auto readCharacters = static_cast<uint8_t*>(readBuffer);
+
+	for (size_t position {}; position < size; position += dataSize)
+	{
+		uint16_t word;
+		if (writeCharacters != nullptr)
+		{
+			const uint16_t characterLow = writeCharacters[position];
+			const uint16_t characterHigh = dataSize > 1 ? writeCharacters[position + 1] : 0;
+			word = characterLow | characterHigh << 8;
+		}
+		else
+			word = txDummyData_;
+
+		spiPeripheral_.writeDr(wordLength_, word);
+
+		while ((spiPeripheral_.readSr() & SPI_SR_RXNE) == 0);
+
+		word = spiPeripheral_.readDr(wordLength_);
+		if (readCharacters != nullptr)
+		{
+			readCharacters[position] = word;
+			if (dataSize > 1)
+				readCharacters[position + 1] = word >> 8;
+		}
+	}
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | SpiMasterLowLevelDmaBased::RxDmaChannelFunctor public functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -9,6 +9,18 @@
 
 list(APPEND DISTORTOS_SPIMASTER_BUFFER_ALIGNMENTS 1)
 
+distortosSetConfiguration(INTEGER
+		distortos_Peripherals_SPI_Polling_threshold
+		8
+		MIN 0
+		MAX 256
+		HELP "Size of longest SPI transfer executed by polling, bytes.
+
+		DMA-based low-level SPI master drivers execute transfers which are not longer than this value by polling the
+		peripheral, without configuring DMA channels and without any interrupts. This reduces the latency of short
+		command and status transfers, but the CPU is busy for the whole duration of such transfer. 0 disables polling."
+		OUTPUT_NAME DISTORTOS_CHIP_SPI_POLLING_THRESHOLD)
+
 target_include_directories(distortos PUBLIC
 		${CMAKE_CURRENT_LIST_DIR}/include)
 
@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \brief CompareMatchTickSource class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/CompareMatchTickSource.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cassert>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::chrono::nanoseconds CompareMatchTickSource::getTimeSinceTick() const
+{
+	constexpr uint64_t nanosecondsPerSecond {1000000000};
+	constexpr uint64_t tickFrequency {DISTORTOS_TICK_FREQUENCY};
+
+	// all values below are in 1 / DISTORTOS_TICK_FREQUENCY units of counter's cycle; period_ and error_ already
+	// describe the next tick, so nominal instant of last tick is nominal instant of next tick minus nominal period
+	const auto tickOffset = uint64_t{period_} * tickFrequency + error_ - counterFrequency_;
+	const auto elapsed = uint64_t{getElapsedCycles()} * tickFrequency;
+	// last tick may be handled up to one cycle before its nominal instant
+	if (elapsed <= tickOffset)
+		return {};
+
+	const auto sinceTick = elapsed - tickOffset;
+	return std::chrono::nanoseconds{(sinceTick / tickFrequency * nanosecondsPerSecond +
+			sinceTick % tickFrequency * nanosecondsPerSecond / tickFrequency) / counterFrequency_};
+}
+
+void CompareMatchTickSource::interruptHandler()
+{
+	while (1)
+	{
+		while (getElapsedCycles() >= period_)
+		{
+			lastTick_ = (lastTick_ + period_) & counterMask_;
+			updatePeriod();
+			handleTick();
+		}
+
+		setCompare((lastTick_ + period_) & counterMask_);
+
+		// if the counter did not pass new compare value before it was written, compare-match cannot be missed
+		if (getElapsedCycles() < period_)
+			return;
+	}
+}
+
+void CompareMatchTickSource::start()
+{
+	assert(counterFrequency_ >= DISTORTOS_TICK_FREQUENCY &&
+			counterFrequency_ / DISTORTOS_TICK_FREQUENCY < counterMask_ / 2 &&
+			"Tick period must be non-zero and shorter than half of counter's range!");
+
+	error_ = {};
+	lastTick_ = getCounter() & counterMask_;
+	updatePeriod();
+	setCompare((lastTick_ + period_) & counterMask_);
+	startCounter();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void CompareMatchTickSource::updatePeriod()
+{
+	period_ = counterFrequency_ / DISTORTOS_TICK_FREQUENCY;
+	error_ += counterFrequency_ % DISTORTOS_TICK_FREQUENCY;
+	if (error_ >= DISTORTOS_TICK_FREQUENCY)
+	{
+		error_ -= DISTORTOS_TICK_FREQUENCY;
+		++period_;
+	}
+}
+
+}	// namespace distortos
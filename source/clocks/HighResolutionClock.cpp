@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief HighResolutionClock class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/HighResolutionClock.hpp"
+
+#include "distortos/architecture/getTimeSinceTick.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+HighResolutionClock::time_point HighResolutionClock::now()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto tickCount = internal::getScheduler().getTickCount();
+	return time_point{TickClock::duration{tickCount} + architecture::getTimeSinceTick()};
+}
+
+}	// namespace distortos
@@ -0,0 +1,152 @@
+/**
+ * \file
+ * \brief AsynchronousBlockDevice class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/devices/memory/AsynchronousBlockDevice.hpp"
+
+#include "distortos/devices/memory/BlockDevice.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace devices
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+AsynchronousBlockDevice::~AsynchronousBlockDevice()
+{
+	assert(requests_.empty() == true);
+}
+
+void AsynchronousBlockDevice::run()
+{
+	while (1)
+	{
+		while (semaphore_.wait() != 0);
+
+		BlockDeviceRequest* request;
+		{
+			const InterruptMaskingLock interruptMaskingLock;
+
+			if (requests_.empty() == true)
+			{
+				if (stopRequested_ == true)
+				{
+					stopRequested_ = false;
+					return;
+				}
+
+				continue;
+			}
+
+			// request stays on the list while it is executed, so the destructor can detect it
+			request = &requests_.front();
+		}
+
+		const auto ret = execute(*request);
+
+		{
+			const InterruptMaskingLock interruptMaskingLock;
+
+			requests_.pop_front();
+		}
+
+		request->ret_ = ret;
+		if (request->callback_ != nullptr)
+		{
+			request->completing_ = true;
+			request->callback_(*request);
+			request->completing_ = false;
+		}
+
+		{
+			const InterruptMaskingLock interruptMaskingLock;
+
+			if (request->node_.isLinked() == true)	// request was resubmitted by its callback
+				continue;
+
+			// request is not touched after it is no longer pending, as it may be destroyed right away
+			request->semaphore_.post();
+			request->pending_ = false;
+		}
+	}
+}
+
+int AsynchronousBlockDevice::stop()
+{
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		stopRequested_ = true;
+	}
+
+	return semaphore_.post();
+}
+
+int AsynchronousBlockDevice::submit(BlockDeviceRequest& request)
+{
+	// request which is still pending may be resubmitted only from its callback - its completion was not signaled yet
+	const auto resubmission = request.completing_;
+	assert(request.pending_ == false || (resubmission == true && request.node_.isLinked() == false));
+
+	if (resubmission == false)
+		request.semaphore_.tryWait();	// drop completion of previous use of this request which nobody waited for
+	request.ret_ = {};
+	request.pending_ = true;
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		requests_.push_back(request);
+	}
+
+	const auto ret = semaphore_.post();
+	if (ret != 0)
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		decltype(requests_)::erase(decltype(requests_)::iterator{request});
+		request.pending_ = resubmission;	// failed resubmission is completed by run() when callback returns
+	}
+
+	return ret;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int AsynchronousBlockDevice::execute(const BlockDeviceRequest& request) const
+{
+	switch (request.type_)
+	{
+	case BlockDeviceRequest::Type::erase:
+		return blockDevice_.erase(request.address_, request.size_);
+	case BlockDeviceRequest::Type::read:
+		return blockDevice_.read(request.address_, request.buffer_, request.size_);
+	case BlockDeviceRequest::Type::synchronize:
+		return blockDevice_.synchronize();
+	case BlockDeviceRequest::Type::write:
+		return blockDevice_.write(request.address_, request.buffer_, request.size_);
+	}
+
+	return EINVAL;
+}
+
+}	// namespace devices
+
+}	// namespace distortos
@@ -327,6 +327,44 @@ int BufferingBlockDevice::write(uint64_t address, const void* buffer, size_t siz
 	return {};
 }
 
+int BufferingBlockDevice::writeGather(const uint64_t address, const WriteSegmentsRange segments)
+{
+	const std::lock_guard<BufferingBlockDevice> lockGuard {*this};
+
+	assert(openCount_ != 0);
+
+	uint64_t size {};
+	for (auto& segment : segments)
+		size += segment.size;
+
+	if (size < writeBufferSize_)
+		return BlockDevice::writeGather(address, segments);
+
+	const auto blockSize = blockDevice_.getBlockSize();
+	assert(address % blockSize == 0 && size % blockSize == 0);
+	assert(address + size <= blockDevice_.getSize());
+
+	const AddressRange writeRange {address, size};
+
+	{
+		const AddressRange writeBufferRange {writeBufferAddress_, writeBufferValidSize_};
+		if ((writeRange & writeBufferRange).size() != 0)
+		{
+			// buffered data is older than written data, so it must reach the device first
+			const auto ret = flushWriteBuffer();
+			if (ret != 0)
+				return ret;
+		}
+	}
+	{
+		const AddressRange readBufferRange {readBufferAddress_, readBufferSize_ * readBufferValid_};
+		if ((writeRange & readBufferRange).size() != 0)
+			readBufferValid_ = {};
+	}
+
+	return blockDevice_.writeGather(address, segments);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
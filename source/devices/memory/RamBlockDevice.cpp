@@ -0,0 +1,149 @@
+/**
+ * \file
+ * \brief RamBlockDevice class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/devices/memory/RamBlockDevice.hpp"
+
+#include <limits>
+#include <mutex>
+
+#include <cassert>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace devices
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+RamBlockDevice::~RamBlockDevice()
+{
+	assert(openCount_ == 0);
+}
+
+int RamBlockDevice::close()
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+
+	--openCount_;
+	return {};
+}
+
+int RamBlockDevice::erase(const uint64_t address, const uint64_t size)
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+	assert(address % blockSize_ == 0 && size % blockSize_ == 0);
+	assert(address + size <= size_);
+
+	memset(buffer_ + address, 0xff, size);
+	++statistics_.erases;
+	statistics_.erasedBytes += size;
+	return {};
+}
+
+size_t RamBlockDevice::getBlockSize() const
+{
+	return blockSize_;
+}
+
+uint64_t RamBlockDevice::getSize() const
+{
+	return size_;
+}
+
+auto RamBlockDevice::getStatistics() -> Statistics
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	return statistics_;
+}
+
+void RamBlockDevice::lock()
+{
+	const auto ret = mutex_.lock();
+	assert(ret == 0);
+}
+
+int RamBlockDevice::open()
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ < std::numeric_limits<decltype(openCount_)>::max());
+	assert(buffer_ != nullptr);
+	assert(blockSize_ != 0 && (blockSize_ & (blockSize_ - 1)) == 0);
+	assert(size_ % blockSize_ == 0);
+
+	++openCount_;
+	return {};
+}
+
+int RamBlockDevice::read(const uint64_t address, void* const buffer, const size_t size)
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+	assert(buffer != nullptr);
+	assert(address % blockSize_ == 0 && size % blockSize_ == 0);
+	assert(address + size <= size_);
+
+	memcpy(buffer, buffer_ + address, size);
+	++statistics_.reads;
+	statistics_.readBytes += size;
+	return {};
+}
+
+void RamBlockDevice::resetStatistics()
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	statistics_ = {};
+}
+
+int RamBlockDevice::synchronize()
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+
+	return {};
+}
+
+void RamBlockDevice::unlock()
+{
+	const auto ret = mutex_.unlock();
+	assert(ret == 0);
+}
+
+int RamBlockDevice::write(const uint64_t address, const void* const buffer, const size_t size)
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+	assert(buffer != nullptr);
+	assert(address % blockSize_ == 0 && size % blockSize_ == 0);
+	assert(address + size <= size_);
+
+	memcpy(buffer_ + address, buffer, size);
+	++statistics_.writes;
+	statistics_.writtenBytes += size;
+	return {};
+}
+
+}	// namespace devices
+
+}	// namespace distortos
@@ -0,0 +1,176 @@
+/**
+ * \file
+ * \brief RamMemoryTechnologyDevice class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/devices/memory/RamMemoryTechnologyDevice.hpp"
+
+#include <limits>
+#include <mutex>
+
+#include <cassert>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace devices
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+RamMemoryTechnologyDevice::~RamMemoryTechnologyDevice()
+{
+	assert(openCount_ == 0);
+}
+
+int RamMemoryTechnologyDevice::close()
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+
+	--openCount_;
+	return {};
+}
+
+int RamMemoryTechnologyDevice::erase(const uint64_t address, const uint64_t size)
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+	assert(address % eraseBlockSize_ == 0 && size % eraseBlockSize_ == 0);
+	assert(address + size <= size_);
+
+	memset(buffer_ + address, 0xff, size);
+
+	const auto blocks = size / eraseBlockSize_;
+	if (eraseCounters_ != nullptr)
+		for (auto block = address / eraseBlockSize_; block < (address + size) / eraseBlockSize_; ++block)
+			++eraseCounters_[block];
+
+	++statistics_.erases;
+	statistics_.erasedBlocks += blocks;
+	statistics_.busyTime += timings_.eraseTime * blocks;
+	return {};
+}
+
+size_t RamMemoryTechnologyDevice::getEraseBlockSize() const
+{
+	return eraseBlockSize_;
+}
+
+size_t RamMemoryTechnologyDevice::getProgramBlockSize() const
+{
+	return programBlockSize_;
+}
+
+size_t RamMemoryTechnologyDevice::getReadBlockSize() const
+{
+	return readBlockSize_;
+}
+
+uint64_t RamMemoryTechnologyDevice::getSize() const
+{
+	return size_;
+}
+
+auto RamMemoryTechnologyDevice::getStatistics() -> Statistics
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	return statistics_;
+}
+
+void RamMemoryTechnologyDevice::lock()
+{
+	const auto ret = mutex_.lock();
+	assert(ret == 0);
+}
+
+int RamMemoryTechnologyDevice::open()
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ < std::numeric_limits<decltype(openCount_)>::max());
+	assert(buffer_ != nullptr);
+	assert(readBlockSize_ != 0 && (readBlockSize_ & (readBlockSize_ - 1)) == 0);
+	assert(programBlockSize_ != 0 && (programBlockSize_ & (programBlockSize_ - 1)) == 0);
+	assert(eraseBlockSize_ != 0 && (eraseBlockSize_ & (eraseBlockSize_ - 1)) == 0);
+	assert(eraseBlockSize_ >= readBlockSize_ && eraseBlockSize_ >= programBlockSize_);
+	assert(size_ % eraseBlockSize_ == 0);
+
+	++openCount_;
+	return {};
+}
+
+int RamMemoryTechnologyDevice::program(const uint64_t address, const void* const buffer, const size_t size)
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+	assert(buffer != nullptr);
+	assert(address % programBlockSize_ == 0 && size % programBlockSize_ == 0);
+	assert(address + size <= size_);
+
+	const auto source = static_cast<const uint8_t*>(buffer);
+	const auto destination = buffer_ + address;
+	for (size_t i {}; i < size; ++i)
+		destination[i] &= source[i];
+
+	++statistics_.programs;
+	statistics_.programmedBytes += size;
+	statistics_.busyTime += timings_.programTime * (size / programBlockSize_);
+	return {};
+}
+
+int RamMemoryTechnologyDevice::read(const uint64_t address, void* const buffer, const size_t size)
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+	assert(buffer != nullptr);
+	assert(address % readBlockSize_ == 0 && size % readBlockSize_ == 0);
+	assert(address + size <= size_);
+
+	memcpy(buffer, buffer_ + address, size);
+
+	++statistics_.reads;
+	statistics_.readBytes += size;
+	statistics_.busyTime += timings_.readTime * (size / readBlockSize_);
+	return {};
+}
+
+void RamMemoryTechnologyDevice::resetStatistics()
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	statistics_ = {};
+}
+
+int RamMemoryTechnologyDevice::synchronize()
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
+
+	assert(openCount_ != 0);
+
+	return {};
+}
+
+void RamMemoryTechnologyDevice::unlock()
+{
+	const auto ret = mutex_.unlock();
+	assert(ret == 0);
+}
+
+}	// namespace devices
+
+}	// namespace distortos
@@ -1565,62 +1565,28 @@ int SdCard::write(const uint64_t address, const void* const buffer, const size_t
 	const std::lock_guard<Mutex> lockGuard {mutex_};
 
 	assert(openCount_ != 0);
-	assert(buffer != nullptr && address % blockSize == 0 && size % blockSize == 0);
-
-	const auto firstBlock = address / blockSize;
-	const auto blocks = size / blockSize;
-	assert(firstBlock + blocks <= blocksCount_);
-
-	if (size == 0)
-		return {};
-
-	{
-		const auto ret = waitForTransferState(sdCard_, rca_, busyDeadline_);
-		if (ret != 0)
-			return ret;
-	}
+	assert(buffer != nullptr);
 
-	if (blocks != 1)
-	{
-		int ret;
-		R1Response r1Response;
-		std::tie(ret, r1Response) = executeAcmd23(sdCard_, rca_, blocks);
-		if (ret != 0)
-			return ret;
-		if (r1Response.isError() == true)
-			return EIO;
-	}
+	return writeImplementation(address, {buffer, size, blockSize, writeTimeoutMs_});
+}
 
-	int ret;
+int SdCard::writeGather(const uint64_t address, const WriteSegmentsRange segments)
+{
+	const std::lock_guard<Mutex> lockGuard {mutex_};
 
-	{
-		R1Response r1Response;
-		const auto commandAddress = blockAddressing_ == true ? firstBlock : address;
-		const SdMmcCardLowLevel::WriteTransfer writeTransfer {buffer, size, blockSize, writeTimeoutMs_};
-		std::tie(ret, r1Response) = blocks == 1 ? executeCmd24(sdCard_, commandAddress, writeTransfer) :
-				executeCmd25(sdCard_, commandAddress, writeTransfer);
-		if (ret == 0 && r1Response.isError() == true)
-			ret = EIO;
-	}
+	assert(openCount_ != 0);
 
-	if (blocks != 1 || ret != 0)
+	size_t size {};
+	for (auto& segment : segments)
 	{
-		int cmd12Ret;
-		R1Response r1Response;
-		std::tie(cmd12Ret, r1Response) = executeCmd12(sdCard_);
-		if (ret == 0)
-		{
-			if (cmd12Ret != 0)
-				ret = cmd12Ret;
-			else if (r1Response.isError() == true)
-				ret = EIO;
-		}
+		assert(segment.buffer != nullptr && segment.size != 0 && segment.size % blockSize == 0);
+		size += segment.size;
 	}
 
-	const auto writeTimeout = estd::durationCastCeil<TickClock::duration>(std::chrono::milliseconds{writeTimeoutMs_});
-	busyDeadline_ = TickClock::now() + writeTimeout;
+	if (size == 0)
+		return {};
 
-	return ret;
+	return writeImplementation(address, {segments, size, blockSize, writeTimeoutMs_});
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -1808,6 +1774,66 @@ int SdCard::initialize()
 	return {};
 }
 
+int SdCard::writeImplementation(const uint64_t address, const SdMmcCardLowLevel::WriteTransfer& writeTransfer)
+{
+	const auto size = writeTransfer.getSize();
+	assert(address % blockSize == 0 && size % blockSize == 0);
+
+	const auto firstBlock = address / blockSize;
+	const auto blocks = size / blockSize;
+	assert(firstBlock + blocks <= blocksCount_);
+
+	if (size == 0)
+		return {};
+
+	{
+		const auto ret = waitForTransferState(sdCard_, rca_, busyDeadline_);
+		if (ret != 0)
+			return ret;
+	}
+
+	if (blocks != 1)
+	{
+		int ret;
+		R1Response r1Response;
+		std::tie(ret, r1Response) = executeAcmd23(sdCard_, rca_, blocks);
+		if (ret != 0)
+			return ret;
+		if (r1Response.isError() == true)
+			return EIO;
+	}
+
+	int ret;
+
+	{
+		R1Response r1Response;
+		const auto commandAddress = blockAddressing_ == true ? firstBlock : address;
+		std::tie(ret, r1Response) = blocks == 1 ? executeCmd24(sdCard_, commandAddress, writeTransfer) :
+				executeCmd25(sdCard_, commandAddress, writeTransfer);
+		if (ret == 0 && r1Response.isError() == true)
+			ret = EIO;
+	}
+
+	if (blocks != 1 || ret != 0)
+	{
+		int cmd12Ret;
+		R1Response r1Response;
+		std::tie(cmd12Ret, r1Response) = executeCmd12(sdCard_);
+		if (ret == 0)
+		{
+			if (cmd12Ret != 0)
+				ret = cmd12Ret;
+			else if (r1Response.isError() == true)
+				ret = EIO;
+		}
+	}
+
+	const auto writeTimeout = estd::durationCastCeil<TickClock::duration>(std::chrono::milliseconds{writeTimeoutMs_});
+	busyDeadline_ = TickClock::now() + writeTimeout;
+
+	return ret;
+}
+
 }	// namespace devices
 
 }	// namespace distortos
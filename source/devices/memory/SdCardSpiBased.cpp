@@ -37,6 +37,9 @@ namespace
 static_assert(DISTORTOS_SPIMASTER_BUFFER_ALIGNMENT <= DISTORTOS_BLOCKDEVICE_BUFFER_ALIGNMENT,
 		"Buffer alignment for SpiMaster is greater than for BlockDevice!");
 
+static_assert(DISTORTOS_SDCARDSPIBASED_POLLING_BURST_SIZE <= 512,
+		"Polling burst for SdCardSpiBased must not be larger than block size!");
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local types
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -47,6 +50,9 @@ using Uint8Range = estd::ContiguousRange<uint8_t>;
 /// range of const uint8_t elements
 using ConstUint8Range = estd::ContiguousRange<const uint8_t>;
 
+/// buffer for bytes received from SD card in one polling burst
+using PollingBurst = std::array<uint8_t, DISTORTOS_SDCARDSPIBASED_POLLING_BURST_SIZE>;
+
 /// fields unique to CSD version 1.0
 struct CsdV1
 {
@@ -393,34 +399,50 @@ SdStatus decodeSdStatus(const std::array<uint8_t, 64>& buffer)
 /**
  * \brief Waits while byte received via SPI satisfies predicate.
  *
+ * Bytes which were already received are scanned first. Then the card is polled with transactions which receive whole
+ * \a burst, so a wait which takes many bytes needs only a fraction of transactions.
+ *
  * \tparam Functor is the type of functor, should be callable as bool(const uint8_t&)
  *
  * \param [in] spiMasterHandle is a reference to SpiMasterHandle object used for communication
  * \param [in] duration is the duration of wait before giving up
+ * \param [out] burst is a reference to buffer for bytes received in one polling transaction
+ * \param [in,out] received is a reference to range of bytes which were received but not consumed yet, on success it
+ * is updated to contain bytes received after the returned byte
  * \param [in] functor is the functor used to check predicate
  *
- * \return pair with return code (0 on success, error code otherwise) and last byte that was received; error codes:
+ * \return pair with return code (0 on success, error code otherwise) and first byte that didn't satisfy predicate;
+ * error codes:
  * - ETIMEDOUT - the wait could not be completed before the specified timeout expired;
  * - error codes returned by SpiMasterHandle::executeTransaction();
  */
 
 template<typename Functor>
 std::pair<int, uint8_t> waitWhile(const SpiMasterHandle& spiMasterHandle, const distortos::TickClock::duration duration,
-		Functor functor)
+		PollingBurst& burst, ConstUint8Range& received, Functor functor)
 {
 	const auto deadline = distortos::TickClock::now() + duration;
-	while (distortos::TickClock::now() < deadline)
+	while (1)
 	{
-		uint8_t byte;
-		const SpiMasterTransfer transfer {nullptr, &byte, sizeof(byte)};
+		const auto iterator = std::find_if_not(received.begin(), received.end(), functor);
+		if (iterator != received.end())
+		{
+			received = ConstUint8Range{iterator + 1, received.end()};
+			return {{}, *iterator};
+		}
+
+		received = {};
+
+		if (distortos::TickClock::now() >= deadline)
+			return {ETIMEDOUT, {}};
+
+		const SpiMasterTransfer transfer {nullptr, burst.begin(), burst.size()};
 		const auto ret = spiMasterHandle.executeTransaction(SpiMasterTransfersRange{transfer});
 		if (ret != 0)
 			return {ret, {}};
-		if (functor(byte) == false)
-			return {{}, byte};
-	}
 
-	return {ETIMEDOUT, {}};
+		received = ConstUint8Range{burst};
+	}
 }
 
 /**
@@ -428,14 +450,17 @@ std::pair<int, uint8_t> waitWhile(const SpiMasterHandle& spiMasterHandle, const
  *
  * \param [in] spiMasterHandle is a reference to SpiMasterHandle object used for communication
  * \param [in] duration is the duration of wait before giving up
+ * \param [out] burst is a reference to buffer for bytes received in one polling transaction
+ * \param [in] received is the range of bytes which were already received, may point into \a burst
  *
  * \return 0 on success, error code otherwise:
  * - error codes returned by waitWhile();
  */
 
-int waitWhileBusy(const SpiMasterHandle& spiMasterHandle, const distortos::TickClock::duration duration)
+int waitWhileBusy(const SpiMasterHandle& spiMasterHandle, const distortos::TickClock::duration duration,
+		PollingBurst& burst, ConstUint8Range received)
 {
-	const auto ret = waitWhile(spiMasterHandle, duration,
+	const auto ret = waitWhile(spiMasterHandle, duration, burst, received,
 			[](const uint8_t& byte)
 			{
 				return byte != 0xff;
@@ -443,13 +468,37 @@ int waitWhileBusy(const SpiMasterHandle& spiMasterHandle, const distortos::TickC
 	return ret.first;
 }
 
+/**
+ * \brief Waits while SD card connected via SPI is busy.
+ *
+ * \param [in] spiMasterHandle is a reference to SpiMasterHandle object used for communication
+ * \param [in] duration is the duration of wait before giving up
+ *
+ * \return 0 on success, error code otherwise:
+ * - error codes returned by waitWhileBusy();
+ */
+
+int waitWhileBusy(const SpiMasterHandle& spiMasterHandle, const distortos::TickClock::duration duration)
+{
+	PollingBurst burst;
+	return waitWhileBusy(spiMasterHandle, duration, burst, {});
+}
+
 /**
  * \brief Reads data block from SD card connected via SPI.
  *
+ * Data which was received together with start block token is copied to \a buffer, only the rest is received with
+ * separate transfer. If \a pollNext is true, the first polling burst for the next data block of multi block read is
+ * received in the same transaction as this data block.
+ *
  * \param [in] spiMasterHandle is a reference to SpiMasterHandle object used for communication
  * \param [out] buffer is a pointer to buffer for received data
  * \param [in] size is the size of data block that should be read, bytes
  * \param [in] duration is the duration of wait before giving up
+ * \param [out] burst is a reference to buffer for bytes received in one polling transaction
+ * \param [in,out] received is a reference to range of bytes which were received but not consumed yet
+ * \param [in] pollNext selects whether the first polling burst for the next data block should be received (true) or
+ * not (false)
  *
  * \return 0 on success, error code otherwise:
  * - EIO - unexpected control token was read;
@@ -458,10 +507,11 @@ int waitWhileBusy(const SpiMasterHandle& spiMasterHandle, const distortos::TickC
  */
 
 int readDataBlock(const SpiMasterHandle& spiMasterHandle, void* const buffer, const size_t size,
-		const distortos::TickClock::duration duration)
+		const distortos::TickClock::duration duration, PollingBurst& burst, ConstUint8Range& received,
+		const bool pollNext)
 {
 	{
-		const auto ret = waitWhile(spiMasterHandle, duration,
+		const auto ret = waitWhile(spiMasterHandle, duration, burst, received,
 				[](const uint8_t& byte)
 				{
 					return byte == 0xff;
@@ -472,12 +522,53 @@ int readDataBlock(const SpiMasterHandle& spiMasterHandle, void* const buffer, co
 			return EIO;
 	}
 
-	const SpiMasterTransfer transfers[]
+	constexpr size_t crcSize {2};
+	const auto receivedDataSize = std::min(received.size(), size);
+	std::copy_n(received.begin(), receivedDataSize, static_cast<uint8_t*>(buffer));
+	const auto receivedCrcSize = std::min(received.size() - receivedDataSize, crcSize);
+
+	SpiMasterTransfer transfers[]
 	{
-			{nullptr, buffer, size},
-			{nullptr, nullptr, 2},	// crc
+			{nullptr, static_cast<uint8_t*>(buffer) + receivedDataSize, size - receivedDataSize},
+			{nullptr, nullptr, crcSize - receivedCrcSize},
+			{nullptr, burst.begin(), burst.size()},
 	};
-	return spiMasterHandle.executeTransaction(SpiMasterTransfersRange{transfers});
+	const auto transfersEnd = std::remove_if(std::begin(transfers), std::end(transfers) - (pollNext == false),
+			[](const SpiMasterTransfer& transfer)
+			{
+				return transfer.getSize() == 0;
+			});
+	received = {};
+	if (transfersEnd == std::begin(transfers))
+		return {};
+
+	const auto ret = spiMasterHandle.executeTransaction(SpiMasterTransfersRange{std::begin(transfers), transfersEnd});
+	if (ret != 0)
+		return ret;
+
+	if (pollNext == true)
+		received = ConstUint8Range{burst};
+	return {};
+}
+
+/**
+ * \brief Reads single data block from SD card connected via SPI.
+ *
+ * \param [in] spiMasterHandle is a reference to SpiMasterHandle object used for communication
+ * \param [out] buffer is a pointer to buffer for received data
+ * \param [in] size is the size of data block that should be read, bytes
+ * \param [in] duration is the duration of wait before giving up
+ *
+ * \return 0 on success, error code otherwise:
+ * - error codes returned by readDataBlock();
+ */
+
+int readDataBlock(const SpiMasterHandle& spiMasterHandle, void* const buffer, const size_t size,
+		const distortos::TickClock::duration duration)
+{
+	PollingBurst burst;
+	ConstUint8Range received {};
+	return readDataBlock(spiMasterHandle, buffer, size, duration, burst, received, false);
 }
 
 /**
@@ -499,6 +590,7 @@ int writeDataBlock(const SpiMasterHandle& spiMasterHandle, const uint8_t token,
 		const size_t size, const distortos::TickClock::duration duration)
 {
 	uint8_t footer[3];	// crc + data response token
+	PollingBurst burst;	// first polling burst while card is busy
 	{
 		const uint8_t header[] {0xff, token};
 		const SpiMasterTransfer transfers[]
@@ -506,13 +598,14 @@ int writeDataBlock(const SpiMasterHandle& spiMasterHandle, const uint8_t token,
 				{&header, nullptr, sizeof(header)},
 				{buffer, nullptr, size},
 				{nullptr, footer, sizeof(footer)},
+				{nullptr, burst.begin(), burst.size()},
 		};
 		const auto ret = spiMasterHandle.executeTransaction(SpiMasterTransfersRange{transfers});
 		if (ret != 0)
 			return ret;
 	}
 	{
-		const auto ret = waitWhileBusy(spiMasterHandle, duration);
+		const auto ret = waitWhileBusy(spiMasterHandle, duration, burst, ConstUint8Range{burst});
 		if (ret != 0)
 			return ret;
 	}
@@ -1328,9 +1421,12 @@ int SdCardSpiBased::read(const uint64_t address, void* const buffer, const size_
 		}
 
 		const auto bufferUint8 = static_cast<uint8_t*>(buffer);
+		PollingBurst burst;
+		ConstUint8Range received {};
 		for (size_t block {}; block < blocks; ++block)
 		{
-			const auto ret = readDataBlock(spiMasterHandle, bufferUint8 + block * blockSize, blockSize, readTimeout);
+			const auto ret = readDataBlock(spiMasterHandle, bufferUint8 + block * blockSize, blockSize, readTimeout,
+					burst, received, block + 1 < blocks);
 			if (ret != 0)
 				return ret;
 		}
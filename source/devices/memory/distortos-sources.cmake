@@ -7,10 +7,26 @@
 # distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #
 
+distortosSetConfiguration(INTEGER
+		distortos_Devices_00_Polling_burst_of_SD_card_connected_via_SPI
+		16
+		MIN 1
+		MAX 512
+		HELP "Number of bytes received in one transaction while polling SD card connected via SPI.
+
+		distortos::devices::SdCardSpiBased receives this many bytes at once while waiting for start block token or for
+		the end of busy state and scans them, so a long wait needs only a fraction of SPI transactions. Data which
+		follows start block token in the same burst is used as a part of the block. The buffer for one burst is
+		allocated on the stack of the thread which uses the SD card."
+		OUTPUT_NAME DISTORTOS_SDCARDSPIBASED_POLLING_BURST_SIZE)
+
 target_sources(distortos PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/AsynchronousBlockDevice.cpp
 		${CMAKE_CURRENT_LIST_DIR}/BlockDeviceToMemoryTechnologyDevice.cpp
 		${CMAKE_CURRENT_LIST_DIR}/BufferingBlockDevice.cpp
 		${CMAKE_CURRENT_LIST_DIR}/QspiNorFlashSpiBased.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RamBlockDevice.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RamMemoryTechnologyDevice.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SdCard.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SdCardSpiBased.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SpiEeprom.cpp
@@ -19,8 +19,11 @@
 
 #include "distortos/FileSystem/File.hpp"
 
+#include "distortos/Mutex.hpp"
+
 #include "estd/ScopeGuard.hpp"
 
+#include <algorithm>
 #include <mutex>
 
 #include <cassert>
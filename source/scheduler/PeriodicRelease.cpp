@@ -0,0 +1,116 @@
+/**
+ * \file
+ * \brief PeriodicRelease class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/PeriodicRelease.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+PeriodicRelease::~PeriodicRelease()
+{
+	stop();
+}
+
+auto PeriodicRelease::getStatistics() const -> Statistics
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return statistics_;
+}
+
+void PeriodicRelease::resetStatistics()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	statistics_ = {0, 0, 0, TickClock::duration::max(), TickClock::duration::zero()};
+}
+
+int PeriodicRelease::start(const TickClock::time_point firstReleaseTimePoint, const TickClock::duration period)
+{
+	if (period <= TickClock::duration::zero())
+		return EINVAL;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	SoftwareTimerCommon::stop();
+	while (semaphore_.tryWait() == 0);	// discard pending release
+	resetStatistics();
+	nextReleaseTimePoint_ = firstReleaseTimePoint;
+	pendingReleaseTimePoint_ = firstReleaseTimePoint;
+	period_ = period;
+	return SoftwareTimerCommon::start(firstReleaseTimePoint, period);
+}
+
+int PeriodicRelease::stop()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	period_ = {};
+	return SoftwareTimerCommon::stop();
+}
+
+int PeriodicRelease::wait()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		if (semaphore_.getValue() != 0)	// next release happened before previous activation finished?
+			++statistics_.overruns;
+	}
+
+	const auto ret = semaphore_.wait();
+	if (ret != 0)
+		return ret;
+
+	const auto now = TickClock::now();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto latency = now - pendingReleaseTimePoint_;
+	if (latency < statistics_.minLatency)
+		statistics_.minLatency = latency;
+	if (latency > statistics_.maxLatency)
+		statistics_.maxLatency = latency;
+
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void PeriodicRelease::run()
+{
+	const auto releaseTimePoint = nextReleaseTimePoint_;
+	// software timer is restarted at its previous time point + period, so this stays in sync without any drift
+	nextReleaseTimePoint_ += period_;
+	++statistics_.releases;
+
+	if (semaphore_.post() != 0)	// previous release was not consumed yet?
+	{
+		++statistics_.missedReleases;
+		return;
+	}
+
+	pendingReleaseTimePoint_ = releaseTimePoint;
+}
+
+}	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadControlBlock class implementation
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -40,6 +40,26 @@ namespace
 /// next value of sequence number
 uintptr_t nextSequenceNumber;
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether change of effective priority should be propagated further in the chain of transitive priority
+ * inheritance.
+ *
+ * \param [in] depth is the position of thread in the chain of transitive priority inheritance
+ *
+ * \return true if change of effective priority of thread at \a depth should be propagated to the next thread in the
+ * chain, false otherwise
+ */
+
+constexpr bool shouldPropagate(const uint8_t depth)
+{
+	return DISTORTOS_PRIORITY_INHERITANCE_MAX_CHAIN_DEPTH == 0 ||
+			depth + 1 < DISTORTOS_PRIORITY_INHERITANCE_MAX_CHAIN_DEPTH;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -63,7 +83,12 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 				unblockFunctor_{},
 				roundRobinQuantum_{},
 				schedulingPolicy_{schedulingPolicy},
+#ifdef DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+				state_{ThreadState::created},
+				fpuFree_{}
+#else	// !def DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
 				state_{ThreadState::created}
+#endif	// !def DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
 {
 	_REENT_INIT_PTR(&reent_);
 
@@ -86,7 +111,12 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 				unblockFunctor_{},
 				roundRobinQuantum_{},
 				schedulingPolicy_{schedulingPolicy},
+#ifdef DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+				state_{ThreadState::created},
+				fpuFree_{}
+#else	// !def DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
 				state_{ThreadState::created}
+#endif	// !def DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
 {
 	_REENT_INIT_PTR(&reent_);
 
@@ -102,6 +132,10 @@ ThreadControlBlock::~ThreadControlBlock()
 
 	const InterruptMaskingLock interruptMaskingLock;
 
+	// unlink from thread group while interrupts are masked - destructor of the node runs without this lock, so a thread
+	// traversing the group (e.g. in statistics::getStackUsage()) could preempt it in the middle of unlinking
+	threadGroupNode.unlink();
+
 	_reclaim_reent(&reent_);
 }
 
@@ -119,6 +153,24 @@ int ThreadControlBlock::addHook()
 	return 0;
 }
 
+void ThreadControlBlock::lowerBoostedPriority(const uint8_t previousBoostedPriority, const uint8_t depth)
+{
+	// lowered mutex was not the source of boosting? when propagation along the chain of transitive priority
+	// inheritance is limited, boosted priority may be stale (too high), so it must always be recalculated
+	if (DISTORTOS_PRIORITY_INHERITANCE_MAX_CHAIN_DEPTH == 0 && previousBoostedPriority < boostedPriority_)
+		return;
+
+	updateBoostedPriority({}, depth);
+}
+
+void ThreadControlBlock::raiseBoostedPriority(const uint8_t boostedPriority, const uint8_t depth)
+{
+	if (boostedPriority <= boostedPriority_)
+		return;
+
+	setBoostedPriority(boostedPriority, depth);
+}
+
 void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -131,14 +183,21 @@ void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBe
 
 	const auto previousEffectivePriority = getEffectivePriority();
 	priority_ = priority;
+	const auto newEffectivePriority = getEffectivePriority();
 
-	if (previousEffectivePriority == getEffectivePriority() || threadListNode.isLinked() == false)
+	if (previousEffectivePriority == newEffectivePriority || threadListNode.isLinked() == false)
 		return;
 
 	reposition(loweringBefore);
 
-	if (priorityInheritanceMutexControlBlock_ != nullptr)
-		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+	if (priorityInheritanceMutexControlBlock_ == nullptr)
+		return;
+
+	auto& owner = *priorityInheritanceMutexControlBlock_->getOwner();
+	if (newEffectivePriority > previousEffectivePriority)
+		owner.raiseBoostedPriority(newEffectivePriority);
+	else
+		owner.lowerBoostedPriority(previousEffectivePriority);
 }
 
 void ThreadControlBlock::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
@@ -158,7 +217,7 @@ void ThreadControlBlock::unblockHook(const UnblockReason unblockReason)
 		(*unblockFunctor)(*this, unblockReason);
 }
 
-void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
+void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority, const uint8_t depth)
 {
 	decltype(boostedPriority_) newBoostedPriority {boostedPriority};
 
@@ -168,25 +227,7 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 		newBoostedPriority = std::max(newBoostedPriority, mutexBoostedPriority);
 	}
 
-	if (boostedPriority_ == newBoostedPriority)
-		return;
-
-	const auto oldEffectivePriority = getEffectivePriority();
-	boostedPriority_ = newBoostedPriority;
-	const auto newEffectivePriority = getEffectivePriority();
-
-	if (oldEffectivePriority == newEffectivePriority || threadListNode.isLinked() == false)
-		return;
-
-	const auto loweringBefore = newEffectivePriority < oldEffectivePriority;
-
-	reposition(loweringBefore);
-
-	// this code is placed here, even though it could be moved to ThreadControlBlock::reposition(), simplifying
-	// ThreadControlBlock::setPriority(). This way optimizer can remove recursive calls to this function, reducing
-	// memory usage of threads.
-	if (priorityInheritanceMutexControlBlock_ != nullptr)
-		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+	setBoostedPriority(newBoostedPriority, depth);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -208,6 +249,35 @@ void ThreadControlBlock::reposition(const bool loweringBefore)
 	getScheduler().maybeRequestContextSwitch();
 }
 
+void ThreadControlBlock::setBoostedPriority(const uint8_t boostedPriority, const uint8_t depth)
+{
+	if (boostedPriority_ == boostedPriority)
+		return;
+
+	const auto oldEffectivePriority = getEffectivePriority();
+	boostedPriority_ = boostedPriority;
+	const auto newEffectivePriority = getEffectivePriority();
+
+	if (oldEffectivePriority == newEffectivePriority || threadListNode.isLinked() == false)
+		return;
+
+	const auto loweringBefore = newEffectivePriority < oldEffectivePriority;
+
+	reposition(loweringBefore);
+
+	if (priorityInheritanceMutexControlBlock_ == nullptr || shouldPropagate(depth) == false)
+		return;
+
+	// this code is placed here, even though it could be moved to ThreadControlBlock::reposition(), simplifying
+	// ThreadControlBlock::setPriority(). This way optimizer can remove recursive calls to this function, reducing
+	// memory usage of threads.
+	auto& owner = *priorityInheritanceMutexControlBlock_->getOwner();
+	if (loweringBefore == false)
+		owner.raiseBoostedPriority(newEffectivePriority, depth + 1);
+	else
+		owner.lowerBoostedPriority(oldEffectivePriority, depth + 1);
+}
+
 }	// namespace internal
 
 }	// namespace distortos
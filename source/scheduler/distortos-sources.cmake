@@ -12,7 +12,9 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/forceContextSwitch.cpp
 		${CMAKE_CURRENT_LIST_DIR}/getScheduler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/IdleThread.cpp
+		${CMAKE_CURRENT_LIST_DIR}/interruptMaskingStatistics.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MainThread.cpp
+		${CMAKE_CURRENT_LIST_DIR}/PeriodicRelease.cpp
 		${CMAKE_CURRENT_LIST_DIR}/RoundRobinQuantum.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Scheduler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerCommon.cpp
@@ -0,0 +1,110 @@
+/**
+ * \file
+ * \brief Implementation of interrupt masking statistics
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/recordInterruptMaskingSection.hpp"
+
+#ifdef DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
+
+#include "distortos/statistics.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+static_assert(statistics::interruptMaskingHistogramBins == 32, "Histogram must have one bin per bit of duration!");
+
+/// histogram of durations of sections with masked interrupts
+uint32_t histogram_[statistics::interruptMaskingHistogramBins];
+
+/// the longest sections with masked interrupts, sorted by decreasing duration
+statistics::InterruptMaskingSection longestSections_[DISTORTOS_INTERRUPT_MASKING_STATISTICS_SECTIONS];
+
+/// number of valid elements in longestSections_
+size_t longestSectionsCount_;
+
+}	// namespace
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void recordInterruptMaskingSection(const void* const maskingAddress, const void* const unmaskingAddress,
+		const uint32_t duration)
+{
+	{
+		const auto bin = 31 - __builtin_clz(duration | 1);
+		if (histogram_[bin] != UINT32_MAX)
+			++histogram_[bin];
+	}
+
+	constexpr size_t maxLongestSections {sizeof(longestSections_) / sizeof(*longestSections_)};
+	if (longestSectionsCount_ == maxLongestSections && duration <= longestSections_[maxLongestSections - 1].duration)
+		return;
+
+	if (longestSectionsCount_ < maxLongestSections)
+		++longestSectionsCount_;
+
+	auto i = longestSectionsCount_ - 1;
+	for (; i > 0 && longestSections_[i - 1].duration < duration; --i)
+		longestSections_[i] = longestSections_[i - 1];
+	longestSections_[i] = {maskingAddress, unmaskingAddress, duration};
+}
+
+}	// namespace internal
+
+namespace statistics
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void getInterruptMaskingHistogram(const estd::ContiguousRange<uint32_t> histogram)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	std::copy_n(histogram_, std::min(histogram.size(), interruptMaskingHistogramBins), histogram.begin());
+}
+
+size_t getLongestInterruptMaskingSections(const estd::ContiguousRange<InterruptMaskingSection> sections)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	std::copy_n(longestSections_, std::min(sections.size(), longestSectionsCount_), sections.begin());
+	return longestSectionsCount_;
+}
+
+void resetInterruptMaskingStatistics()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	std::fill(std::begin(histogram_), std::end(histogram_), 0);
+	longestSectionsCount_ = {};
+}
+
+}	// namespace statistics
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE
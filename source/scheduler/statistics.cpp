@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,8 +11,15 @@
 
 #include "distortos/statistics.hpp"
 
+#include "distortos/architecture/getInterruptStack.hpp"
+
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
 
 namespace distortos
 {
@@ -29,6 +36,42 @@ uint64_t getContextSwitchCount()
 	return internal::getScheduler().getContextSwitchCount();
 }
 
+size_t getStackUsage(const estd::ContiguousRange<StackUsage> stackUsages)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	size_t count {};
+
+	{
+		const auto interruptStack = architecture::getInterruptStack();
+		const internal::Stack stack {interruptStack.first, interruptStack.second};
+		if (count < stackUsages.size())
+			stackUsages.begin()[count] = {{}, stack.getSize(), stack.getHighWaterMark()};
+		++count;
+	}
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto threadGroupControlBlock =
+			internal::getScheduler().getCurrentThreadControlBlock().getThreadGroupControlBlock();
+	if (threadGroupControlBlock == nullptr)
+		return count;
+
+	threadGroupControlBlock->forEach(
+			[stackUsages, &count](const internal::ThreadControlBlock& threadControlBlock)
+			{
+				if (count < stackUsages.size())
+				{
+					const auto& stack = threadControlBlock.getStack();
+					stackUsages.begin()[count] = {{threadControlBlock, threadControlBlock.getSequenceNumber()},
+							stack.getSize(), stack.getHighWaterMark()};
+				}
+				++count;
+			});
+
+	return count;
+}
+
 }	// namespace statistics
 
 }	// namespace distortos
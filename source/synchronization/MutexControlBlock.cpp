@@ -48,8 +48,9 @@ public:
 	/**
 	 * \brief PriorityInheritanceMutexControlBlockUnblockFunctor's function call operator
 	 *
-	 * If the wait for mutex was interrupted, requests update of boosted priority of current owner of the mutex. Pointer
-	 * to MutexControlBlock with priorityInheritance protocol which caused the thread to block is reset to nullptr.
+	 * If the wait for mutex was interrupted, requests lowering of boosted priority of current owner of the mutex.
+	 * Pointer to MutexControlBlock with priorityInheritance protocol which caused the thread to block is reset to
+	 * nullptr.
 	 *
 	 * \param [in] threadControlBlock is a reference to ThreadControlBlock that is being unblocked
 	 * \param [in] unblockReason is the reason of thread unblocking
@@ -61,7 +62,7 @@ public:
 
 		// waiting for mutex was interrupted and some thread still holds it?
 		if (unblockReason != UnblockReason::unblockRequest && owner != nullptr)
-			owner->updateBoostedPriority();
+			owner->lowerBoostedPriority(threadControlBlock.getEffectivePriority());
 
 		threadControlBlock.setPriorityInheritanceMutexControlBlock(nullptr);
 	}
@@ -126,12 +127,13 @@ void MutexControlBlock::doLock()
 	getOwner()->getOwnedProtocolMutexList().push_front(*this);
 
 	if (getProtocol() == Protocol::priorityProtect)
-		getOwner()->updateBoostedPriority();
+		getOwner()->raiseBoostedPriority(getPriorityCeiling());
 }
 
 void MutexControlBlock::doUnlockOrTransferLock()
 {
 	auto& oldOwner = *getOwner();
+	const auto oldBoostedPriority = getBoostedPriority();
 
 	if (blockedList_.empty() == false)
 		doTransferLock();
@@ -141,12 +143,12 @@ void MutexControlBlock::doUnlockOrTransferLock()
 	if (getProtocol() == Protocol::none)
 		return;
 
-	oldOwner.updateBoostedPriority();
+	oldOwner.lowerBoostedPriority(oldBoostedPriority);
 
 	if (getOwner() == nullptr)
 		return;
 
-	getOwner()->updateBoostedPriority();
+	getOwner()->raiseBoostedPriority(getBoostedPriority());
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -163,7 +165,7 @@ void MutexControlBlock::beforeBlock() const
 	currentThreadControlBlock.setPriorityInheritanceMutexControlBlock(this);
 
 	// calling thread is not yet on the blocked list, that's why it's effective priority is given explicitly
-	getOwner()->updateBoostedPriority(currentThreadControlBlock.getEffectivePriority());
+	getOwner()->raiseBoostedPriority(currentThreadControlBlock.getEffectivePriority());
 }
 
 void MutexControlBlock::doTransferLock()
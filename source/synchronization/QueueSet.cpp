@@ -0,0 +1,162 @@
+/**
+ * \file
+ * \brief QueueSet class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/QueueSet.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+QueueSet::~QueueSet()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	for (size_t i {}; i < membersCount_; ++i)
+		members_[i].semaphore->queueSet_ = {};
+}
+
+int QueueSet::remove(const void* const object)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	for (size_t i {}; i < membersCount_; ++i)
+		if (members_[i].object == object)
+		{
+			members_[i].semaphore->queueSet_ = {};
+			members_[i] = members_[--membersCount_];
+			if (nextMember_ >= membersCount_)
+				nextMember_ = {};
+			return 0;
+		}
+
+	return ENOENT;
+}
+
+std::pair<int, const void*> QueueSet::tryWait()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto readyMember = findReadyMember();
+	return {readyMember != nullptr ? 0 : EAGAIN, readyMember};
+}
+
+std::pair<int, const void*> QueueSet::tryWaitFor(const TickClock::duration duration)
+{
+	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+std::pair<int, const void*> QueueSet::tryWaitUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	while (1)
+	{
+		const auto readyMember = findReadyMember();
+		if (readyMember != nullptr)
+			return {{}, readyMember};
+
+		const auto ret = internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnQueueSet, timePoint);
+		if (ret != 0)
+			return {ret, {}};
+	}
+}
+
+std::pair<int, const void*> QueueSet::wait()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	while (1)
+	{
+		const auto readyMember = findReadyMember();
+		if (readyMember != nullptr)
+			return {{}, readyMember};
+
+		const auto ret = internal::getScheduler().block(blockedList_, ThreadState::blockedOnQueueSet);
+		if (ret != 0)
+			return {ret, {}};
+	}
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int QueueSet::add(const void* const object, Semaphore& semaphore)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (semaphore.queueSet_ != nullptr)
+		return EBUSY;
+
+	if (membersCount_ == maxMembers_)
+		return ENOSPC;
+
+	members_[membersCount_++] = {object, &semaphore};
+	semaphore.queueSet_ = this;
+
+	if (semaphore.getValue() != 0)
+		notify();
+
+	return 0;
+}
+
+const void* QueueSet::findReadyMember()
+{
+	for (size_t i {}; i < membersCount_; ++i)
+	{
+		const auto index = (nextMember_ + i) % membersCount_;
+		if (members_[index].semaphore->getValue() != 0)
+		{
+			nextMember_ = (index + 1) % membersCount_;
+			return members_[index].object;
+		}
+	}
+
+	return {};
+}
+
+void QueueSet::notify()
+{
+	if (blockedList_.empty() == false)
+		internal::getScheduler().unblock(blockedList_.begin());
+}
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void notifyQueueSet(QueueSet& queueSet)
+{
+	queueSet.notify();
+}
+
+}	// namespace internal
+
+}	// namespace distortos
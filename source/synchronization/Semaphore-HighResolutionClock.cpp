@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief Implementation of Semaphore's functions with timeouts of HighResolutionClock
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/Semaphore.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int Semaphore::tryWaitFor(const HighResolutionClock::duration duration)
+{
+	return tryWaitUntil(HighResolutionClock::now() + duration);
+}
+
+int Semaphore::tryWaitUntil(const HighResolutionClock::time_point timePoint)
+{
+	{
+		const TickClock::time_point tickTimePoint
+		{
+				std::chrono::duration_cast<TickClock::duration>(timePoint.time_since_epoch())
+		};
+		const auto ret = tryWaitUntil(tickTimePoint);
+		if (ret != ETIMEDOUT)
+			return ret;
+	}
+
+	// polling for the remaining part of the tick, always shorter than one tick period
+	while (HighResolutionClock::now() < timePoint)
+	{
+		const auto ret = tryWait();
+		if (ret != EAGAIN)
+			return ret;
+	}
+
+	return ETIMEDOUT;
+}
+
+}	// namespace distortos
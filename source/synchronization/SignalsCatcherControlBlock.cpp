@@ -24,6 +24,7 @@
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/SignalInformation.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 
@@ -70,27 +71,6 @@ std::pair<int, SignalInformation> acceptPendingUnblockedSignal(SignalsReceiverCo
 	return signalsReceiverControlBlock.acceptPendingSignal(signalNumber);
 }
 
-/**
- * \brief Tries to find SignalsCatcherControlBlock::Association for given signal number in given range.
- *
- * \param [in] begin is a pointer to first element of range of SignalsCatcherControlBlock::Association objects
- * \param [in] end is a pointer to "one past the last" element of range of SignalsCatcherControlBlock::Association
- * objects
- * \param [in] signalNumber is the signal for which the association will be searched
- *
- * \return pointer to found SignalsCatcherControlBlock::Association object, \e end if no match was found
- */
-
-SignalsCatcherControlBlock::Association* findAssociation(SignalsCatcherControlBlock::Association* const begin,
-		SignalsCatcherControlBlock::Association* const end, const uint8_t signalNumber)
-{
-	return std::find_if(begin, end,
-			[signalNumber](const SignalsCatcherControlBlock::Association& association) -> bool
-			{
-				return association.first.getBitset()[signalNumber];
-			});
-}
-
 /**
  * \brief Tries to find SignalsCatcherControlBlock::Association for given SignalAction in given range.
  *
@@ -183,7 +163,7 @@ SignalsCatcherControlBlock::SignalsCatcherControlBlock(StorageUniquePointer&& st
 		storageEnd_{&storageUniquePointer_[storageSize]},
 		deliveryIsPending_{}
 {
-
+	std::fill(std::begin(associationIndexes_), std::end(associationIndexes_), noAssociation);
 }
 
 SignalsCatcherControlBlock::~SignalsCatcherControlBlock()
@@ -217,7 +197,7 @@ std::pair<int, SignalAction> SignalsCatcherControlBlock::getAssociation(const ui
 	if (signalNumber >= SignalSet::Bitset{}.size())
 		return {EINVAL, {}};
 
-	const auto association = findAssociation(getAssociationsBegin(), associationsEnd_, signalNumber);
+	const auto association = lookUpAssociation(signalNumber);
 	if (association == associationsEnd_)	// there is no association for this signal number?
 		return {{}, {}};
 
@@ -236,7 +216,7 @@ std::pair<int, SignalAction> SignalsCatcherControlBlock::setAssociation(const ui
 		return {{}, previousSignalAction};
 	}
 
-	const auto numberAssociation = findAssociation(getAssociationsBegin(), associationsEnd_, signalNumber);
+	const auto numberAssociation = lookUpAssociation(signalNumber);
 	const auto actionAssociation = findAssociation(getAssociationsBegin(), associationsEnd_, signalAction);
 
 	if (actionAssociation != associationsEnd_)	// there is an association for this SignalAction?
@@ -245,6 +225,7 @@ std::pair<int, SignalAction> SignalsCatcherControlBlock::setAssociation(const ui
 			return {{}, signalAction};
 
 		actionAssociation->first.add(signalNumber);
+		associationIndexes_[signalNumber] = actionAssociation - getAssociationsBegin();
 		const auto previousSignalAction = numberAssociation != associationsEnd_ ?
 				clearAssociation(signalNumber, *numberAssociation) : SignalAction{};
 		return {{}, previousSignalAction};
@@ -267,6 +248,7 @@ std::pair<int, SignalAction> SignalsCatcherControlBlock::setAssociation(const ui
 	if (storageBegin_ == storageEnd_)
 		abort();	/// \todo replace with assertion
 	new (associationsEnd_) Association{signalSet, signalAction};
+	associationIndexes_[signalNumber] = associationsEnd_ - getAssociationsBegin();
 	++associationsEnd_;
 	return {{}, previousSignalAction};
 }
@@ -293,7 +275,7 @@ void SignalsCatcherControlBlock::setSignalMask(const SignalSet signalMask,
 
 SignalAction SignalsCatcherControlBlock::clearAssociation(const uint8_t signalNumber)
 {
-	const auto association = findAssociation(getAssociationsBegin(), associationsEnd_, signalNumber);
+	const auto association = lookUpAssociation(signalNumber);
 	if (association == associationsEnd_)	// there is no association for this signal number?
 		return {};
 
@@ -303,8 +285,12 @@ SignalAction SignalsCatcherControlBlock::clearAssociation(const uint8_t signalNu
 SignalAction SignalsCatcherControlBlock::clearAssociation(const uint8_t signalNumber, Association& association)
 {
 	const auto previousSignalAction = association.second;
+	const uint8_t index = &association - getAssociationsBegin();
 
 	association.first.remove(signalNumber);	// signal number is valid (checked by caller)
+	// signal number may already be associated with another SignalAction
+	if (associationIndexes_[signalNumber] == index)
+		associationIndexes_[signalNumber] = noAssociation;
 
 	// can this association be removed (it has no more signal numbers associated)?
 	if (association.first.getBitset().none() == true)
@@ -313,11 +299,26 @@ SignalAction SignalsCatcherControlBlock::clearAssociation(const uint8_t signalNu
 		association = lastAssociation;	// replace removed association with the last association in the range
 		lastAssociation.~Association();
 		--associationsEnd_;
+
+		// update indexes of signal numbers associated with moved association
+		auto bitset = &association != associationsEnd_ ? association.first.getBitset().to_ulong() : 0;
+		while (bitset != 0)
+		{
+			// GCC builtin - "count trailing zeros" - https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
+			associationIndexes_[__builtin_ctzl(bitset)] = index;
+			bitset &= bitset - 1;
+		}
 	}
 
 	return previousSignalAction;
 }
 
+auto SignalsCatcherControlBlock::lookUpAssociation(const uint8_t signalNumber) const -> Association*
+{
+	const auto index = associationIndexes_[signalNumber];
+	return index != noAssociation ? getAssociationsBegin() + index : associationsEnd_;
+}
+
 int SignalsCatcherControlBlock::requestDeliveryOfSignals(ThreadControlBlock& threadControlBlock)
 {
 	if (deliveryIsPending_ == false)
@@ -0,0 +1,98 @@
+/**
+ * \file
+ * \brief WorkQueue class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/WorkQueue.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+WorkQueue::~WorkQueue()
+{
+	assert(workItems_.empty() == true);
+}
+
+bool WorkQueue::cancel(WorkItem& workItem)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (workItem.pending_ == false)
+		return false;
+
+	decltype(workItems_)::erase(decltype(workItems_)::iterator{workItem});
+	workItem.pending_ = false;
+	return true;
+}
+
+void WorkQueue::run()
+{
+	while (1)
+	{
+		while (semaphore_.wait() != 0);
+
+		WorkItem* workItem;
+		{
+			const InterruptMaskingLock interruptMaskingLock;
+
+			// list may be empty if work item was cancelled
+			if (workItems_.empty() == true)
+			{
+				if (stopRequested_ == true)
+				{
+					stopRequested_ = false;
+					return;
+				}
+
+				continue;
+			}
+
+			workItem = &workItems_.front();
+			workItems_.pop_front();
+			workItem->pending_ = false;
+		}
+
+		workItem->function_(*workItem);
+	}
+}
+
+int WorkQueue::stop()
+{
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		stopRequested_ = true;
+	}
+
+	return semaphore_.post();
+}
+
+int WorkQueue::submit(WorkItem& workItem)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (workItem.pending_ == true)	// coalesce with request which is already pending
+		return 0;
+
+	const auto ret = semaphore_.post();
+	if (ret != 0)
+		return ret;
+
+	workItems_.insert(workItem);
+	workItem.pending_ = true;
+	return 0;
+}
+
+}	// namespace distortos
@@ -0,0 +1,128 @@
+/**
+ * \file
+ * \brief ZeroLatencyNotification class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/ZeroLatencyNotification.hpp"
+
+#ifdef DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+#include "distortos/architecture/requestContextSwitch.hpp"
+
+#include "distortos/Semaphore.hpp"
+
+#if ATOMIC_INT_LOCK_FREE != 2 || ATOMIC_POINTER_LOCK_FREE != 2
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#endif	// ATOMIC_INT_LOCK_FREE != 2 || ATOMIC_POINTER_LOCK_FREE != 2
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// lock-free LIFO list of pending notifications
+std::atomic<ZeroLatencyNotification*> pendingNotifications;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ZeroLatencyNotification::notify()
+{
+#if ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_POINTER_LOCK_FREE == 2
+
+	count_.fetch_add(1, std::memory_order_relaxed);
+
+	if (queued_.exchange(true, std::memory_order_acq_rel) == false)
+	{
+		next_ = pendingNotifications.load(std::memory_order_relaxed);
+		while (pendingNotifications.compare_exchange_weak(next_, this, std::memory_order_release,
+				std::memory_order_relaxed) == false);
+	}
+
+#else	// ATOMIC_INT_LOCK_FREE != 2 || ATOMIC_POINTER_LOCK_FREE != 2
+
+	// without lock-free read-modify-write operations there is no kernel BASEPRI, so all interrupts are kernel-aware
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+		if (queued_.load(std::memory_order_relaxed) == false)
+		{
+			queued_.store(true, std::memory_order_relaxed);
+			next_ = pendingNotifications.load(std::memory_order_relaxed);
+			pendingNotifications.store(this, std::memory_order_relaxed);
+		}
+	}
+
+#endif	// ATOMIC_INT_LOCK_FREE != 2 || ATOMIC_POINTER_LOCK_FREE != 2
+
+	architecture::requestContextSwitch();
+}
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void deliverZeroLatencyNotifications()
+{
+#if ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_POINTER_LOCK_FREE == 2
+
+	auto notification = pendingNotifications.exchange(nullptr, std::memory_order_acquire);
+
+#else	// ATOMIC_INT_LOCK_FREE != 2 || ATOMIC_POINTER_LOCK_FREE != 2
+
+	// kernel's interrupt masking is enabled, so nothing can preempt this function
+	auto notification = pendingNotifications.load(std::memory_order_relaxed);
+	pendingNotifications.store(nullptr, std::memory_order_relaxed);
+
+#endif	// ATOMIC_INT_LOCK_FREE != 2 || ATOMIC_POINTER_LOCK_FREE != 2
+
+	while (notification != nullptr)
+	{
+		// next_ must be read before queued_ is cleared, as concurrent notify() may link the object again
+		const auto next = notification->next_;
+		notification->queued_.store(false, std::memory_order_release);
+
+#if ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_POINTER_LOCK_FREE == 2
+
+		auto count = notification->count_.exchange(0, std::memory_order_relaxed);
+
+#else	// ATOMIC_INT_LOCK_FREE != 2 || ATOMIC_POINTER_LOCK_FREE != 2
+
+		auto count = notification->count_.load(std::memory_order_relaxed);
+		notification->count_.store(0, std::memory_order_relaxed);
+
+#endif	// ATOMIC_INT_LOCK_FREE != 2 || ATOMIC_POINTER_LOCK_FREE != 2
+
+		while (count != 0 && notification->semaphore_.post() == 0)
+			--count;
+
+		notification = next;
+	}
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
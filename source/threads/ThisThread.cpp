@@ -2,7 +2,7 @@
  * \file
  * \brief ThisThread namespace implementation
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -41,6 +41,17 @@ int detach()
 
 #endif	// def DISTORTOS_THREAD_DETACH_ENABLE
 
+#ifdef DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+
+void declareFpuFree()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	internal::getScheduler().getCurrentThreadControlBlock().setFpuFree();
+}
+
+#endif	// def DISTORTOS_LAZY_FPU_CONTEXT_SWITCH_ENABLE
+
 void exit()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -113,6 +124,11 @@ int sleepFor(const TickClock::duration duration)
 	return sleepUntil(TickClock::now() + duration + TickClock::duration{1});
 }
 
+int sleepFor(const HighResolutionClock::duration duration)
+{
+	return sleepUntil(HighResolutionClock::now() + duration);
+}
+
 int sleepUntil(const TickClock::time_point timePoint)
 {
 	auto& scheduler = internal::getScheduler();
@@ -121,6 +137,24 @@ int sleepUntil(const TickClock::time_point timePoint)
 	return ret == ETIMEDOUT ? 0 : ret;
 }
 
+int sleepUntil(const HighResolutionClock::time_point timePoint)
+{
+	{
+		const TickClock::time_point tickTimePoint
+		{
+				std::chrono::duration_cast<TickClock::duration>(timePoint.time_since_epoch())
+		};
+		const auto ret = sleepUntil(tickTimePoint);
+		if (ret != 0)
+			return ret;
+	}
+
+	// active waiting for the remaining part of the tick, always shorter than one tick period
+	while (HighResolutionClock::now() < timePoint);
+
+	return 0;
+}
+
 void yield()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -2,7 +2,7 @@
  * \file
  * \brief MutexPriorityInheritanceOperationsTestCase class implementation
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -185,6 +185,39 @@ constexpr size_t testThreadStackSize {512};
 | local functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * \brief Main function of thread used in testLimitedChainDepth().
+ *
+ * Locks first mutex, sleeps for given duration, locks second mutex and then unlocks both of them.
+ *
+ * \param [in] firstMutex is a reference to first mutex, locked before sleeping
+ * \param [in] secondMutex is a reference to second mutex, locked after sleeping
+ * \param [in] duration is the duration of sleep
+ * \param [out] ret is a reference to variable for combined return value of Mutex::lock() / Mutex::unlock()
+ */
+
+void lockSleepLockThread(Mutex& firstMutex, Mutex& secondMutex, const TickClock::duration duration, int& ret)
+{
+	ret = firstMutex.lock();
+	ThisThread::sleepFor(duration);
+
+	{
+		const auto localRet = secondMutex.lock();
+		if (localRet != 0)
+			ret = localRet;
+	}
+	{
+		const auto localRet = secondMutex.unlock();
+		if (localRet != 0)
+			ret = localRet;
+	}
+	{
+		const auto localRet = firstMutex.unlock();
+		if (localRet != 0)
+			ret = localRet;
+	}
+}
+
 /**
  * \brief Tests basic priority inheritance mechanism of mutexes with priorityInheritance protocol.
  *
@@ -575,6 +608,91 @@ bool testPriorityChange(const Mutex::Type type)
 	return result;
 }
 
+/**
+ * \brief Tests behavior of priority inheritance mechanism of mutexes when the length of the chain of transitive
+ * priority inheritance is limited.
+ *
+ * 3 threads are "connected" into a "vertical" hierarchy with current thread using mutexes. Thread T1 becomes boosted by
+ * thread T2 before it blocks on mutex owned by T0, then T2 times out. With the limit set with
+ * DISTORTOS_PRIORITY_INHERITANCE_MAX_CHAIN_DEPTH, raising and lowering of priority reach main thread at different
+ * depths, so main thread may be left with priority which is higher than expected (boosting is incomplete). This test
+ * checks that such stale boosting is limited to the duration of the chain - after all mutexes are unlocked all
+ * priorities are expected to return to their previous values.
+ *
+ * \param [in] type is the Mutex::Type that will be tested
+ *
+ * \return true if the test case succeeded, false otherwise
+ */
+
+bool testLimitedChainDepth(const Mutex::Type type)
+{
+	constexpr TickClock::duration durationUnit {10};
+	constexpr size_t maxChainDepth {DISTORTOS_PRIORITY_INHERITANCE_MAX_CHAIN_DEPTH};
+	// effective priority of main thread (relative to testThreadPriority) after T2 times out
+	constexpr uint8_t expectedBoost {maxChainDepth == 1 ? 1 : maxChainDepth == 2 ? 3 : 2};
+
+	std::array<Mutex, 3> mutexes
+	{{
+			Mutex{type, Mutex::Protocol::priorityInheritance},
+			Mutex{type, Mutex::Protocol::priorityInheritance},
+			Mutex{type, Mutex::Protocol::priorityInheritance},
+	}};
+
+	LockThread lockThread {&mutexes[1], &mutexes[0], nullptr};
+	int lockSleepLockRet {};
+	TryLockForThread tryLockForThread {nullptr, mutexes[2], durationUnit * 2};
+
+	std::array<DynamicThread, 3> threads
+	{{
+			makeDynamicThread({testThreadStackSize, testThreadPriority + 1}, std::ref(lockThread)),
+			makeDynamicThread({testThreadStackSize, testThreadPriority + 2}, lockSleepLockThread, std::ref(mutexes[2]),
+					std::ref(mutexes[1]), durationUnit, std::ref(lockSleepLockRet)),
+			makeDynamicThread({testThreadStackSize, testThreadPriority + 3}, std::ref(tryLockForThread)),
+	}};
+
+	bool result {true};
+
+	{
+		const auto ret = mutexes[0].lock();
+		if (ret != 0)
+			result = false;
+	}
+
+	// T0 locks M1 and blocks on M0, T1 locks M2 and sleeps, T2 blocks on M2 with timeout
+	for (auto& thread : threads)
+		thread.start();
+
+	if (ThisThread::getEffectivePriority() != testThreadPriority + 1)
+		result = false;
+
+	// T1 wakes up and blocks on M1, then T2 times out
+	ThisThread::sleepFor(durationUnit * 3);
+
+	if (ThisThread::getEffectivePriority() != testThreadPriority + expectedBoost)
+		result = false;
+
+	{
+		const auto ret = mutexes[0].unlock();
+		if (ret != 0)
+			result = false;
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	if (ThisThread::getEffectivePriority() != testThreadPriority)
+		result = false;
+
+	for (size_t i = 0; i < threads.size(); ++i)
+		if (threads[i].getEffectivePriority() != static_cast<uint8_t>(testThreadPriority + i + 1))
+			result = false;
+
+	if (lockThread.getRet() != 0 || lockSleepLockRet != 0 || tryLockForThread.getRet() != ETIMEDOUT)
+		result = false;
+
+	return result;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -604,6 +722,12 @@ bool MutexPriorityInheritanceOperationsTestCase::run_() const
 				return result;
 		}
 
+		{
+			const auto result = testLimitedChainDepth(type);
+			if (result != true)
+				return result;
+		}
+
 		{
 			const auto result = testPriorityChange(type);
 			if (result != true)
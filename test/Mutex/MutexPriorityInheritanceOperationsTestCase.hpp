@@ -2,7 +2,7 @@
  * \file
  * \brief MutexPriorityInheritanceOperationsTestCase class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -26,6 +26,7 @@ namespace test
  * Tests:
  * - basic priority inheritance mechanism of mutexes with priorityInheritance protocol,
  * - behavior of priority inheritance mechanism of mutexes in the event of canceled (timed-out) lock attempt,
+ * - behavior of priority inheritance mechanism of mutexes when the length of the chain is limited,
  * - behavior of priority inheritance mechanism of mutexes in the event of priority change.
  */
 
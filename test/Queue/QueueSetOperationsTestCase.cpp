@@ -0,0 +1,294 @@
+/**
+ * \file
+ * \brief QueueSetOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "QueueSetOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticMessageQueue.hpp"
+#include "distortos/StaticQueueSet.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of data transferred through queues in tests
+using TestType = uint32_t;
+
+/// RawFifoQueue used in tests
+using TestRawFifoQueue = StaticRawFifoQueue<sizeof(TestType), 1>;
+
+/// MessageQueue used in tests
+using TestMessageQueue = StaticMessageQueue<TestType, 1>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in phase2 block involving tryWaitFor() or tryWaitUntil() (excluding
+/// waitForNextTick()): 1 - main thread blocks on queue set (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2TryForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase3 block involving software timer (excluding waitForNextTick()): 1 -
+/// main thread blocks on queue set (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3SoftwareTimerContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests adding and removing members and non-blocking tryWait().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	// members are declared before the sets, so they are destroyed after the sets
+	Semaphore semaphore1 {0};
+	Semaphore semaphore2 {0};
+	TestRawFifoQueue rawFifoQueue;
+	TestMessageQueue messageQueue;
+	StaticQueueSet<3> queueSet;
+	StaticQueueSet<1> otherQueueSet;
+
+	// set is empty, so tryWait() should fail immediately
+	if (queueSet.tryWait().first != EAGAIN)
+		return false;
+
+	if (queueSet.add(semaphore1) != 0 || queueSet.add(semaphore2) != 0 || queueSet.add(rawFifoQueue) != 0 ||
+			queueSet.getSize() != 3)
+		return false;
+
+	// set is full
+	if (queueSet.add(messageQueue) != ENOSPC || queueSet.remove(&messageQueue) != ENOENT)
+		return false;
+
+	// semaphore is already a member of another set
+	if (otherQueueSet.add(semaphore1) != EBUSY)
+		return false;
+
+	// no member is ready
+	if (queueSet.tryWait().first != EAGAIN)
+		return false;
+
+	// both semaphores are ready, so they should be returned in round-robin order
+	if (semaphore1.post() != 0 || semaphore2.post() != 0)
+		return false;
+	for (const auto expectedMember : {&semaphore1, &semaphore2, &semaphore1, &semaphore2})
+	{
+		const auto ret = queueSet.tryWait();
+		if (ret.first != 0 || ret.second != expectedMember)
+			return false;
+	}
+
+	if (semaphore1.tryWait() != 0 || semaphore2.tryWait() != 0 || queueSet.tryWait().first != EAGAIN)
+		return false;
+
+	{
+		const TestType value {0x5a6b7c8d};
+		if (rawFifoQueue.tryPush(value) != 0)
+			return false;
+
+		const auto ret = queueSet.tryWait();
+		if (ret.first != 0 || ret.second != &rawFifoQueue)
+			return false;
+
+		TestType readValue {};
+		if (rawFifoQueue.tryPop(readValue) != 0 || readValue != value || queueSet.tryWait().first != EAGAIN)
+			return false;
+	}
+
+	// removed semaphore should not be reported by the set and may be added to another set
+	if (queueSet.remove(&semaphore1) != 0 || semaphore1.post() != 0 || queueSet.tryWait().first != EAGAIN ||
+			otherQueueSet.add(semaphore1) != 0)
+		return false;
+
+	{
+		const auto ret = otherQueueSet.tryWait();
+		if (ret.first != 0 || ret.second != &semaphore1 || semaphore1.tryWait() != 0)
+			return false;
+	}
+
+	// member which is already ready when added to the set should be reported immediately
+	if (messageQueue.tryPush(0, TestType{}) != 0 || queueSet.add(messageQueue) != 0)
+		return false;
+
+	{
+		const auto ret = queueSet.tryWait();
+		if (ret.first != 0 || ret.second != &messageQueue)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Tests timeouts of tryWaitFor() and tryWaitUntil().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Semaphore semaphore {0};
+	TestRawFifoQueue rawFifoQueue;
+	StaticQueueSet<2> queueSet;
+
+	if (queueSet.add(semaphore) != 0 || queueSet.add(rawFifoQueue) != 0)
+		return false;
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// no member is ready, so tryWaitFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = queueSet.tryWaitFor(singleDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2TryForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// no member is ready, so tryWaitUntil() should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = queueSet.tryWaitUntil(requestedTimePoint);
+		if (ret.first != ETIMEDOUT || requestedTimePoint != TickClock::now() ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2TryForUntilContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Tests waiting for members which become ready in interrupt context.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	Semaphore semaphore {0};
+	TestRawFifoQueue rawFifoQueue;
+	StaticQueueSet<2> queueSet;
+	const TestType value {0x1e2d3c4b};
+
+	if (queueSet.add(semaphore) != 0 || queueSet.add(rawFifoQueue) != 0)
+		return false;
+
+	{
+		auto softwareTimer = makeStaticSoftwareTimer(
+				[&rawFifoQueue, &value]()
+				{
+					rawFifoQueue.tryPush(value);
+				});
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// no member is ready, but wait() should succeed at expected time
+		const auto ret = queueSet.wait();
+		const auto wokenUpTimePoint = TickClock::now();
+		TestType readValue {};
+		if (ret.first != 0 || ret.second != &rawFifoQueue || wakeUpTimePoint != wokenUpTimePoint ||
+				rawFifoQueue.tryPop(readValue) != 0 || readValue != value ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	{
+		auto softwareTimer = makeStaticSoftwareTimer(&Semaphore::post, std::ref(semaphore));
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// no member is ready, but tryWaitFor() should succeed at expected time
+		const auto ret = queueSet.tryWaitFor(wakeUpTimePoint - TickClock::now() + longDuration);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret.first != 0 || ret.second != &semaphore || wakeUpTimePoint != wokenUpTimePoint ||
+				semaphore.tryWait() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool QueueSetOperationsTestCase::run_() const
+{
+	constexpr auto phase2ExpectedContextSwitchCount = 2 * waitForNextTickContextSwitchCount +
+			2 * phase2TryForUntilContextSwitchCount;
+	constexpr auto phase3ExpectedContextSwitchCount = 2 * waitForNextTickContextSwitchCount +
+			2 * phase3SoftwareTimerContextSwitchCount;
+	constexpr auto expectedContextSwitchCount = phase2ExpectedContextSwitchCount + phase3ExpectedContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
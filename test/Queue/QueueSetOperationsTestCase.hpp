@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief QueueSetOperationsTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_QUEUESETOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_QUEUESETOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various QueueSet operations.
+ *
+ * Tests adding and removing members, non-blocking tryWait() with round-robin selection of ready members, tryWaitFor()
+ * and tryWaitUntil() timeouts and waiting for members which become ready in interrupt context - these operations must
+ * return expected result, cause expected number of context switches and finish within expected time frame.
+ */
+
+class QueueSetOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_QUEUESETOPERATIONSTESTCASE_HPP_
@@ -11,5 +11,6 @@ target_sources(distortosTest PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/FifoQueuePriorityTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MessageQueuePriorityTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/QueueOperationsTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/QueueSetOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/queueTestCases.cpp
 		${CMAKE_CURRENT_LIST_DIR}/QueueWrappers.cpp)
@@ -14,6 +14,7 @@
 #include "QueueOperationsTestCase.hpp"
 #include "FifoQueuePriorityTestCase.hpp"
 #include "MessageQueuePriorityTestCase.hpp"
+#include "QueueSetOperationsTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -39,12 +40,16 @@ const FifoQueuePriorityTestCase fifoQueuePriorityTestCase;
 /// MessageQueuePriorityTestCase instance
 const MessageQueuePriorityTestCase messageQueuePriorityTestCase;
 
+/// QueueSetOperationsTestCase instance
+const QueueSetOperationsTestCase queueSetOperationsTestCase;
+
 /// array with references to TestCase objects related to queue
 const TestCaseGroup::Range::value_type queueTestCases_[]
 {
 		TestCaseGroup::Range::value_type{operationsTestCase},
 		TestCaseGroup::Range::value_type{fifoQueuePriorityTestCase},
 		TestCaseGroup::Range::value_type{messageQueuePriorityTestCase},
+		TestCaseGroup::Range::value_type{queueSetOperationsTestCase},
 };
 
 }	// namespace
@@ -0,0 +1,115 @@
+/**
+ * \file
+ * \brief SemaphoreZeroLatencyNotificationTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "SemaphoreZeroLatencyNotificationTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/ZeroLatencyNotification.hpp"
+
+#endif	// def DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of notifications sent with interrupts masked
+constexpr Semaphore::Value maskedNotifications {5};
+
+/// priority of test thread, higher than priority of current test thread
+constexpr uint8_t testThreadPriority {SemaphoreZeroLatencyNotificationTestCase::getTestCasePriority() + 1};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread which waits for the semaphore and marks that it was woken.
+ *
+ * \param [in] semaphore is a reference to semaphore for which the thread waits
+ * \param [out] woken is a reference to variable which is set to true when the thread is woken
+ */
+
+void thread(Semaphore& semaphore, volatile bool& woken)
+{
+	if (semaphore.wait() == 0)
+		woken = true;
+}
+
+}	// namespace
+
+#endif	// def DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SemaphoreZeroLatencyNotificationTestCase::run_() const
+{
+#ifdef DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+	Semaphore semaphore {0};
+	ZeroLatencyNotification notification {semaphore};
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		for (Semaphore::Value i {}; i < maskedNotifications; ++i)
+			notification.notify();
+
+		// delivery is deferred until the context switch handler is allowed to run
+		if (semaphore.getValue() != 0)
+			return false;
+	}
+
+	if (semaphore.getValue() != maskedNotifications)
+		return false;
+
+	while (semaphore.tryWait() == 0);
+
+	volatile bool woken {};
+	auto testThread = makeAndStartDynamicThread({testThreadStackSize, testThreadPriority}, thread,
+			std::ref(semaphore), std::ref(woken));
+
+	notification.notify();
+	const bool wokenBeforeReturn {woken};
+
+	testThread.join();
+	if (wokenBeforeReturn == false || semaphore.getValue() != 0)
+		return false;
+
+#endif	// def DISTORTOS_ZERO_LATENCY_NOTIFICATIONS_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
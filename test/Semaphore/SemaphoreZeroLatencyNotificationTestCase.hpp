@@ -0,0 +1,71 @@
+/**
+ * \file
+ * \brief SemaphoreZeroLatencyNotificationTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SEMAPHORE_SEMAPHOREZEROLATENCYNOTIFICATIONTESTCASE_HPP_
+#define TEST_SEMAPHORE_SEMAPHOREZEROLATENCYNOTIFICATIONTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests ZeroLatencyNotification.
+ *
+ * Checks that notifications sent with interrupts masked are delivered as the same number of posts of the semaphore only
+ * after interrupts are unmasked and that a notification wakes a higher-priority thread before notify() returns.
+ */
+
+class SemaphoreZeroLatencyNotificationTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \return priority at which this test case should be executed
+	 */
+
+	constexpr static uint8_t getTestCasePriority()
+	{
+		return testCasePriority_;
+	}
+
+	/**
+	 * \brief SemaphoreZeroLatencyNotificationTestCase's constructor
+	 */
+
+	constexpr SemaphoreZeroLatencyNotificationTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SEMAPHORE_SEMAPHOREZEROLATENCYNOTIFICATIONTESTCASE_HPP_
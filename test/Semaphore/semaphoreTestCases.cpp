@@ -13,6 +13,7 @@
 
 #include "SemaphorePriorityTestCase.hpp"
 #include "SemaphoreOperationsTestCase.hpp"
+#include "SemaphoreZeroLatencyNotificationTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -36,11 +37,15 @@ const SemaphorePriorityTestCase priorityTestCase;
 /// SemaphoreOperationsTestCase instance
 const SemaphoreOperationsTestCase operationsTestCase;
 
+/// SemaphoreZeroLatencyNotificationTestCase instance
+const SemaphoreZeroLatencyNotificationTestCase zeroLatencyNotificationTestCase;
+
 /// array with references to TestCase objects related to semaphores
 const TestCaseGroup::Range::value_type semaphoreTestCases_[]
 {
 		TestCaseGroup::Range::value_type{priorityTestCase},
 		TestCaseGroup::Range::value_type{operationsTestCase},
+		TestCaseGroup::Range::value_type{zeroLatencyNotificationTestCase},
 };
 
 }	// namespace
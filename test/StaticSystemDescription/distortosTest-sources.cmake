@@ -0,0 +1,38 @@
+#
+# file: distortosTest-sources.cmake
+#
+# author: Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+#
+
+target_sources(distortosTest PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/staticSystemDescriptionCompileTest.cpp)
+
+#
+# Each variant of compile test violates one rule of static system description, so it must fail to compile with the
+# static assertion of this rule. Variants are not built by default - they are built by ctest, which checks the output
+# of the build for the expected message.
+#
+
+set(staticSystemDescriptionExpectedFailures
+		"Priority ceiling of mutex is lower than priority of one of the threads which lock it"
+		"Queue is too small for elements pushed by producer during one period of consumer"
+		"Described objects do not fit in RAM budget"
+		"Thread uses more RAM than its description")
+set(variant 1)
+foreach(expectedFailure IN LISTS staticSystemDescriptionExpectedFailures)
+	set(target staticSystemDescriptionCompileTest-${variant})
+	add_executable(${target} EXCLUDE_FROM_ALL
+			${CMAKE_CURRENT_LIST_DIR}/staticSystemDescriptionCompileTest.cpp)
+	target_compile_definitions(${target} PRIVATE
+			STATIC_SYSTEM_DESCRIPTION_EXPECTED_FAILURE=${variant})
+	target_link_libraries(${target} PRIVATE
+			distortos::distortos)
+	add_test(NAME ${target}
+			COMMAND ${CMAKE_COMMAND} --build ${CMAKE_BINARY_DIR} --target ${target})
+	set_tests_properties(${target} PROPERTIES
+			PASS_REGULAR_EXPRESSION "${expectedFailure}")
+	math(EXPR variant "${variant} + 1")
+endforeach()
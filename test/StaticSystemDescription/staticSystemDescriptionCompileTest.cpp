@@ -0,0 +1,172 @@
+/**
+ * \file
+ * \brief Compile test of static system description
+ *
+ * Without STATIC_SYSTEM_DESCRIPTION_EXPECTED_FAILURE this file instantiates the example from documentation of
+ * SystemDescription and checks properties of descriptions with static assertions, so it must compile. When this macro
+ * is defined to one of the values below, one rule is violated and compilation must fail with the static assertion of
+ * that rule:
+ * - 1 - priority ceiling of mutex is lower than priority of one of its users;
+ * - 2 - queue is too small for elements pushed by producer during one period of consumer;
+ * - 3 - described objects do not fit in RAM budget;
+ * - 4 - thread is made with function which is larger than the one in its description.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/StaticSystemDescription.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of data in queue
+using Sample = uint32_t;
+
+/// functor with state, which makes thread object larger than thread with plain function
+struct Functor
+{
+	/// state of functor
+	uint8_t state[64];
+
+	/**
+	 * \brief Function call operator of functor
+	 */
+
+	void operator()() const
+	{
+
+	}
+};
+
+/// description of periodic thread with plain function and no arguments
+using SensorThread = ThreadDescription<10, 1024, 10>;
+
+/// description of periodic thread with plain function and one argument
+using LoggerThread = ThreadDescription<5, 2048, 100, void(&)(int), int>;
+
+/// description of non-periodic thread with functor
+using FunctorThread = ThreadDescription<1, 512, 0, Functor>;
+
+/// description of mutex used by SensorThread and LoggerThread
+using SensorMutex = MutexDescription<10, SensorThread, LoggerThread>;
+
+/// description of queue between SensorThread and LoggerThread
+using SampleQueue = FifoQueueDescription<Sample, 10, SensorThread, LoggerThread>;
+
+/// description of message queue between SensorThread and LoggerThread
+using SampleMessageQueue = MessageQueueDescription<Sample, 10, SensorThread, LoggerThread>;
+
+/// description of binary semaphore
+using SensorSemaphore = SemaphoreDescription<0, 1>;
+
+/// description of whole system
+using System = SystemDescription<16 * 1024, SensorThread, LoggerThread, FunctorThread, SensorMutex, SampleQueue,
+		SampleMessageQueue, SensorSemaphore>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function of SensorThread
+ */
+
+void sensorThreadFunction()
+{
+
+}
+
+/**
+ * \brief Function of LoggerThread
+ *
+ * \param [in] logLevel is the level of logged messages
+ */
+
+void loggerThreadFunction(int)
+{
+
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local compile-time checks
++---------------------------------------------------------------------------------------------------------------------*/
+
+static_assert(System::isRateMonotonic == true, "Priorities of described threads are not rate-monotonic!");
+static_assert(SystemDescription<16 * 1024, ThreadDescription<5, 512, 10>, ThreadDescription<10, 512, 100>>::
+		isRateMonotonic == false, "Inverted priorities of periodic threads are reported as rate-monotonic!");
+
+static_assert(System::stackSize == SensorThread::stackSize + LoggerThread::stackSize + FunctorThread::stackSize,
+		"Invalid total size of stacks!");
+static_assert(System::ramSize == SensorThread::ramSize + LoggerThread::ramSize + FunctorThread::ramSize +
+		SensorMutex::ramSize + SampleQueue::ramSize + SampleMessageQueue::ramSize + SensorSemaphore::ramSize,
+		"Invalid total size of RAM!");
+
+static_assert(LoggerThread::ramSize == sizeof(decltype(LoggerThread::make(loggerThreadFunction, 0))),
+		"Size of thread object differs from its description!");
+static_assert(FunctorThread::ramSize == sizeof(decltype(FunctorThread::make(Functor{}))),
+		"Size of thread object differs from its description!");
+static_assert(FunctorThread::ramSize >= ThreadDescription<1, 512>::ramSize + sizeof(Functor),
+		"State of functor is not included in size of thread!");
+
+#if STATIC_SYSTEM_DESCRIPTION_EXPECTED_FAILURE == 1
+
+static_assert(MutexDescription<9, SensorThread>::ramSize != 0, "");
+
+#elif STATIC_SYSTEM_DESCRIPTION_EXPECTED_FAILURE == 2
+
+static_assert(FifoQueueDescription<Sample, 9, SensorThread, LoggerThread>::ramSize != 0, "");
+
+#elif STATIC_SYSTEM_DESCRIPTION_EXPECTED_FAILURE == 3
+
+static_assert(SystemDescription<System::ramSize - 1, SensorThread, LoggerThread, FunctorThread, SensorMutex,
+		SampleQueue, SampleMessageQueue, SensorSemaphore>::ramSize != 0, "");
+
+#endif	// STATIC_SYSTEM_DESCRIPTION_EXPECTED_FAILURE == 3
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Instantiates objects from the example in documentation of SystemDescription.
+ *
+ * This function is never called - it only makes the compiler instantiate constructors of described objects and make()
+ * functions of described threads.
+ */
+
+void instantiateStaticSystemDescriptionExample()
+{
+	SensorMutex::Object sensorMutex;
+	SensorSemaphore::Object sensorSemaphore;
+	SampleQueue::Object sampleQueue;
+	SampleMessageQueue::Object sampleMessageQueue;
+	auto sensorThread = SensorThread::make(sensorThreadFunction);
+	auto loggerThread = LoggerThread::make(loggerThreadFunction, 0);
+	auto functorThread = FunctorThread::make(Functor{});
+
+#if STATIC_SYSTEM_DESCRIPTION_EXPECTED_FAILURE == 4
+
+	auto undescribedFunctorThread = SensorThread::make(Functor{});
+
+#endif	// STATIC_SYSTEM_DESCRIPTION_EXPECTED_FAILURE == 4
+}
+
+}	// namespace test
+
+}	// namespace distortos
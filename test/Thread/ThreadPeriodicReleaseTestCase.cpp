@@ -0,0 +1,109 @@
+/**
+ * \file
+ * \brief ThreadPeriodicReleaseTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadPeriodicReleaseTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+#include "wasteTime.hpp"
+
+#include "distortos/PeriodicRelease.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// period of releases
+constexpr TickClock::duration period {5};
+
+/// number of releases checked in each phase
+constexpr unsigned int releases {10};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadPeriodicReleaseTestCase::run_() const
+{
+	PeriodicRelease periodicRelease;
+
+	if (periodicRelease.start(TickClock::duration{}) != EINVAL || periodicRelease.isRunning() != false)
+		return false;
+
+	waitForNextTick();
+	const auto start = TickClock::now();
+
+	if (periodicRelease.start(period) != 0 || periodicRelease.isRunning() != true ||
+			periodicRelease.getPeriod() != period)
+		return false;
+
+	// phase 1 - each release must happen exactly at the multiple of the period
+	for (unsigned int i {}; i < releases; ++i)
+	{
+		if (periodicRelease.wait() != 0)
+			return false;
+		if (TickClock::now() != start + (i + 1) * period)
+			return false;
+	}
+
+	{
+		const auto statistics = periodicRelease.getStatistics();
+		if (statistics.releases != releases || statistics.overruns != 0 || statistics.missedReleases != 0 ||
+				statistics.minLatency != TickClock::duration{} || statistics.maxLatency != TickClock::duration{})
+			return false;
+	}
+
+	// phase 2 - activation which takes slightly longer than one period causes an overrun, but no missed release
+	wasteTime(start + (releases + 1) * period + period / 2);
+	if (periodicRelease.wait() != 0 || TickClock::now() != start + (releases + 1) * period + period / 2)
+		return false;
+
+	{
+		const auto statistics = periodicRelease.getStatistics();
+		if (statistics.releases != releases + 1 || statistics.overruns != 1 || statistics.missedReleases != 0 ||
+				statistics.maxLatency != period / 2)
+			return false;
+	}
+
+	// phase 3 - activation which takes longer than two periods causes an overrun and a missed release
+	wasteTime(start + (releases + 3) * period + period / 2);
+	if (periodicRelease.wait() != 0)
+		return false;
+
+	{
+		const auto statistics = periodicRelease.getStatistics();
+		if (statistics.releases != releases + 3 || statistics.overruns != 2 || statistics.missedReleases != 1)
+			return false;
+	}
+
+	// phase 4 - after the overruns the releases must still be aligned to the original grid
+	if (periodicRelease.wait() != 0 || TickClock::now() != start + (releases + 4) * period)
+		return false;
+
+	if (periodicRelease.stop() != 0 || periodicRelease.isRunning() != false)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
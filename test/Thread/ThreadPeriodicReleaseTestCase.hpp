@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief ThreadPeriodicReleaseTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADPERIODICRELEASETESTCASE_HPP_
+#define TEST_THREAD_THREADPERIODICRELEASETESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests periodic release of threads with PeriodicRelease.
+ *
+ * Waits for several consecutive releases, asserting that each one happens exactly at the expected multiple of the
+ * period. Then simulates activations which are longer than the period, asserting that overruns and missed releases are
+ * detected and that no drift is introduced.
+ */
+
+class ThreadPeriodicReleaseTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief ThreadPeriodicReleaseTestCase's constructor
+	 */
+
+	constexpr ThreadPeriodicReleaseTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADPERIODICRELEASETESTCASE_HPP_
@@ -0,0 +1,138 @@
+/**
+ * \file
+ * \brief ThreadSleepUntilHighResolutionTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadSleepUntilHighResolutionTestCase.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// duration of one tick, expressed in units of HighResolutionClock
+constexpr HighResolutionClock::duration tickDuration {TickClock::duration{1}};
+
+/// maximal allowed deviation of time point of waking up
+constexpr HighResolutionClock::duration maxDeviation {tickDuration / 10};
+
+/// number of iterations of monotonicity check
+constexpr size_t monotonicityIterations {10000};
+
+/// tested durations, both shorter and longer than one tick
+constexpr HighResolutionClock::duration durations[]
+{
+		{},
+		tickDuration / 10,
+		tickDuration / 2,
+		tickDuration + tickDuration / 3,
+		tickDuration * 3 + tickDuration / 20,
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether HighResolutionClock is monotonic and consistent with TickClock.
+ *
+ * \return true if the check succeeded, false otherwise
+ */
+
+bool checkMonotonicity()
+{
+	auto previous = HighResolutionClock::now();
+	for (size_t i {}; i < monotonicityIterations; ++i)
+	{
+		const auto tickBefore = TickClock::now();
+		const auto now = HighResolutionClock::now();
+		const auto tickAfter = TickClock::now();
+
+		if (now < previous)
+			return false;
+		if (now.time_since_epoch() < tickBefore.time_since_epoch() ||
+				now.time_since_epoch() >= tickAfter.time_since_epoch() + TickClock::duration{1})
+			return false;
+
+		previous = now;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Checks whether current time point of HighResolutionClock is not earlier than expected time point of waking up
+ * and whether it deviates from it by less than the allowed amount.
+ *
+ * \param [in] timePoint is the expected time point of waking up
+ *
+ * \return true if the check succeeded, false otherwise
+ */
+
+bool checkDeviation(const HighResolutionClock::time_point timePoint)
+{
+	const auto deviation = HighResolutionClock::now() - timePoint;
+	return deviation >= HighResolutionClock::duration{} && deviation < maxDeviation;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadSleepUntilHighResolutionTestCase::run_() const
+{
+	if (checkMonotonicity() == false)
+		return false;
+
+	for (const auto duration : durations)
+	{
+		const auto timePoint = HighResolutionClock::now() + duration;
+		const auto ret = ThisThread::sleepUntil(timePoint);
+		if (ret != 0 || checkDeviation(timePoint) == false)
+			return false;
+	}
+
+	for (const auto duration : durations)
+	{
+		const auto timePoint = HighResolutionClock::now() + duration;
+		const auto ret = ThisThread::sleepFor(duration);
+		if (ret != 0 || checkDeviation(timePoint) == false)
+			return false;
+	}
+
+	Semaphore semaphore {0};
+	for (const auto duration : durations)
+	{
+		const auto timePoint = HighResolutionClock::now() + duration;
+		const auto ret = semaphore.tryWaitFor(duration);
+		if (ret != ETIMEDOUT || checkDeviation(timePoint) == false)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \brief ThreadSleepUntilHighResolutionTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADSLEEPUNTILHIGHRESOLUTIONTESTCASE_HPP_
+#define TEST_THREAD_THREADSLEEPUNTILHIGHRESOLUTIONTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests HighResolutionClock and sleeping of threads with timeouts of this clock.
+ *
+ * Checks whether HighResolutionClock is monotonic and consistent with TickClock, then sleeps until several time points
+ * and for several durations (both shorter and longer than one tick) and asserts that the thread wakes up at requested
+ * time point with deviation smaller than a fraction of the tick. The same is checked for Semaphore::tryWaitFor() with
+ * HighResolutionClock::duration on a semaphore which is never posted.
+ */
+
+class ThreadSleepUntilHighResolutionTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \brief ThreadSleepUntilHighResolutionTestCase's constructor
+	 */
+
+	constexpr ThreadSleepUntilHighResolutionTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADSLEEPUNTILHIGHRESOLUTIONTESTCASE_HPP_
@@ -0,0 +1,137 @@
+/**
+ * \file
+ * \brief ThreadStackUsageTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadStackUsageTestCase.hpp"
+
+#include "distortos/StaticThread.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {1024};
+
+/// size of buffer on stack of test thread, bytes
+constexpr size_t testThreadBufferSize {512};
+
+/// max number of stacks in the report
+constexpr size_t maxStackUsages {32};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread function which uses known amount of its stack.
+ */
+
+void thread()
+{
+	volatile uint8_t buffer[testThreadBufferSize];
+	for (auto& byte : buffer)
+		byte = 0xa5;
+}
+
+/**
+ * \brief Finds entry of thread with given identifier in the report.
+ *
+ * \param [in] stackUsages is an array with the report
+ * \param [in] count is the number of valid entries in \a stackUsages
+ * \param [in] threadIdentifier is the identifier of searched thread
+ *
+ * \return pointer to entry of thread with \a threadIdentifier, nullptr if there is no such entry
+ */
+
+const statistics::StackUsage* findStackUsage(const statistics::StackUsage* const stackUsages, const size_t count,
+		const ThreadIdentifier threadIdentifier)
+{
+	for (size_t i {1}; i < count; ++i)
+		if (stackUsages[i].threadIdentifier == threadIdentifier)
+			return &stackUsages[i];
+
+	return nullptr;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadStackUsageTestCase::run_() const
+{
+	// with empty range only the number of stacks is returned - interrupt stack, main thread and idle thread at least
+	const auto initialCount = statistics::getStackUsage({});
+	if (initialCount < 3 || initialCount >= maxStackUsages)
+		return false;
+
+	{
+		auto testThread = makeAndStartStaticThread<testThreadStackSize>(UINT8_MAX, thread);
+		if (testThread.join() != 0)
+			return false;
+
+		// terminated thread is still in the report until it is destroyed
+		statistics::StackUsage stackUsages[maxStackUsages] {};
+		const auto count = statistics::getStackUsage(estd::ContiguousRange<statistics::StackUsage>{stackUsages});
+		if (count != initialCount + 1)
+			return false;
+
+		const auto& interruptStackUsage = stackUsages[0];
+		if (interruptStackUsage.threadIdentifier != ThreadIdentifier{} || interruptStackUsage.size == 0 ||
+				interruptStackUsage.highWaterMark == 0 ||
+				interruptStackUsage.highWaterMark > interruptStackUsage.size)
+			return false;
+
+		const auto currentThreadStackUsage = findStackUsage(stackUsages, count, ThisThread::get().getIdentifier());
+		if (currentThreadStackUsage == nullptr || currentThreadStackUsage->size != ThisThread::get().getStackSize() ||
+				currentThreadStackUsage->highWaterMark == 0 ||
+				currentThreadStackUsage->highWaterMark > currentThreadStackUsage->size)
+			return false;
+
+		const auto testThreadStackUsage = findStackUsage(stackUsages, count, testThread.getIdentifier());
+		if (testThreadStackUsage == nullptr || testThreadStackUsage->size != testThread.getStackSize() ||
+				testThreadStackUsage->highWaterMark != testThread.getStackHighWaterMark() ||
+				testThreadStackUsage->highWaterMark < testThreadBufferSize ||
+				testThreadStackUsage->highWaterMark > testThreadStackUsage->size)
+			return false;
+
+		// too small range is filled only partially, but total number of stacks is returned
+		statistics::StackUsage partialStackUsages[3] {};
+		constexpr size_t sentinelSize {0x5a5a5a5a};
+		partialStackUsages[2].size = sentinelSize;
+		if (statistics::getStackUsage({partialStackUsages, 2}) != count)
+			return false;
+		if (partialStackUsages[0].threadIdentifier != ThreadIdentifier{} ||
+				partialStackUsages[0].size != interruptStackUsage.size ||
+				partialStackUsages[1].threadIdentifier != stackUsages[1].threadIdentifier ||
+				partialStackUsages[1].size != stackUsages[1].size || partialStackUsages[2].size != sentinelSize)
+			return false;
+	}
+
+	// destroyed thread is removed from the report
+	return statistics::getStackUsage({}) == initialCount;
+}
+
+}	// namespace test
+
+}	// namespace distortos
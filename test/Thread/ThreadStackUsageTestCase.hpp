@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief ThreadStackUsageTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADSTACKUSAGETESTCASE_HPP_
+#define TEST_THREAD_THREADSTACKUSAGETESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests report of stack usage - statistics::getStackUsage().
+ *
+ * Checks the entry of interrupt stack, entries of current thread and of a test thread which uses known amount of its
+ * stack, that the test thread is removed from the report after it is destroyed and that the returned number of stacks
+ * is correct when the output range is too small.
+ */
+
+class ThreadStackUsageTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADSTACKUSAGETESTCASE_HPP_
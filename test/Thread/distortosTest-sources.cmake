@@ -1,7 +1,7 @@
 #
 # file: distortosTest-sources.cmake
 #
-# author: Copyright (C) 2018 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+# author: Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
 #
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
@@ -10,9 +10,12 @@
 target_sources(distortosTest PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ThreadFunctionTypesTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadOperationsTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadPeriodicReleaseTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadPriorityChangeTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadPriorityTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadSchedulingPolicyTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadSleepForTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadSleepUntilHighResolutionTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadSleepUntilTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadStackUsageTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/threadTestCases.cpp)
@@ -2,7 +2,7 @@
  * \file
  * \brief threadTestCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,8 +16,11 @@
 #include "ThreadFunctionTypesTestCase.hpp"
 #include "ThreadSleepForTestCase.hpp"
 #include "ThreadSleepUntilTestCase.hpp"
+#include "ThreadSleepUntilHighResolutionTestCase.hpp"
 #include "ThreadSchedulingPolicyTestCase.hpp"
 #include "ThreadPriorityChangeTestCase.hpp"
+#include "ThreadPeriodicReleaseTestCase.hpp"
+#include "ThreadStackUsageTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -49,12 +52,21 @@ const ThreadSleepForTestCase sleepForTestCase;
 /// ThreadSleepUntilTestCase instance
 const ThreadSleepUntilTestCase sleepUntilTestCase;
 
+/// ThreadSleepUntilHighResolutionTestCase instance
+const ThreadSleepUntilHighResolutionTestCase sleepUntilHighResolutionTestCase;
+
 /// ThreadSchedulingPolicyTestCase instance
 const ThreadSchedulingPolicyTestCase schedulingPolicyTestCase;
 
 /// ThreadPriorityChangeTestCase instance
 const ThreadPriorityChangeTestCase priorityChangeTestCase;
 
+/// ThreadPeriodicReleaseTestCase instance
+const ThreadPeriodicReleaseTestCase periodicReleaseTestCase;
+
+/// ThreadStackUsageTestCase instance
+const ThreadStackUsageTestCase stackUsageTestCase;
+
 /// array with references to TestCase objects related to threads
 const TestCaseGroup::Range::value_type threadTestCases_[]
 {
@@ -63,8 +75,11 @@ const TestCaseGroup::Range::value_type threadTestCases_[]
 		TestCaseGroup::Range::value_type{functionTypesTestCase},
 		TestCaseGroup::Range::value_type{sleepForTestCase},
 		TestCaseGroup::Range::value_type{sleepUntilTestCase},
+		TestCaseGroup::Range::value_type{sleepUntilHighResolutionTestCase},
 		TestCaseGroup::Range::value_type{schedulingPolicyTestCase},
 		TestCaseGroup::Range::value_type{priorityChangeTestCase},
+		TestCaseGroup::Range::value_type{periodicReleaseTestCase},
+		TestCaseGroup::Range::value_type{stackUsageTestCase},
 };
 
 }	// namespace
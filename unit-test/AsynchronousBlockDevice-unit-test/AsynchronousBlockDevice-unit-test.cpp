@@ -0,0 +1,216 @@
+/**
+ * \file
+ * \brief AsynchronousBlockDevice test cases
+ *
+ * This test checks whether AsynchronousBlockDevice executes requests properly and in correct order and whether request
+ * may be resubmitted from its callback.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/devices/memory/AsynchronousBlockDevice.hpp"
+#include "distortos/devices/memory/BlockDevice.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <vector>
+
+using trompeloeil::_;
+using Type = distortos::devices::BlockDeviceRequest::Type;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+class BlockDevice : public distortos::devices::BlockDevice
+{
+public:
+
+	MAKE_MOCK0(close, int());
+	MAKE_MOCK2(erase, int(uint64_t, uint64_t));
+	MAKE_CONST_MOCK0(getBlockSize, size_t());
+	MAKE_CONST_MOCK0(getSize, uint64_t());
+	MAKE_MOCK0(lock, void());
+	MAKE_MOCK0(open, int());
+	MAKE_MOCK3(read, int(uint64_t, void*, size_t));
+	MAKE_MOCK0(synchronize, int());
+	MAKE_MOCK0(unlock, void());
+	MAKE_MOCK3(write, int(uint64_t, const void*, size_t));
+};
+
+/// context of request which is resubmitted from its callback
+struct ResubmissionContext
+{
+	/// pointer to asynchronous block device to which the request is resubmitted
+	distortos::devices::AsynchronousBlockDevice* asynchronousBlockDevice;
+
+	/// results of all completions of the request
+	std::vector<int> results;
+
+	/// number of resubmissions left
+	size_t resubmissions;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Callback of request which appends type of completed request to vector passed as request's context.
+ *
+ * \param [in] request is a reference to completed request
+ */
+
+void callback(distortos::devices::BlockDeviceRequest& request)
+{
+	static_cast<std::vector<Type>*>(request.getContext())->emplace_back(request.getType());
+}
+
+/**
+ * \brief Callback of request which records result of completed request and resubmits it as a read of the next range
+ * until the number of resubmissions in request's context drops to zero.
+ *
+ * \param [in] request is a reference to completed request
+ */
+
+void resubmittingCallback(distortos::devices::BlockDeviceRequest& request)
+{
+	auto& context = *static_cast<ResubmissionContext*>(request.getContext());
+	REQUIRE(request.isPending() == true);
+	context.results.emplace_back(request.getResult());
+	if (context.resubmissions == 0)
+		return;
+
+	--context.resubmissions;
+	request.prepareRead(request.getAddress() + request.getSize(), request.getBuffer(), request.getSize());
+	REQUIRE(context.asynchronousBlockDevice->submit(request) == 0);
+	REQUIRE(request.isPending() == true);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing submit() and run()", "[submit][run]")
+{
+	BlockDevice blockDeviceMock;
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxyMock {};
+	distortos::mock::Semaphore semaphoreMock;
+	trompeloeil::sequence sequence {};
+
+	ALLOW_CALL(interruptMaskingLockProxyMock, construct());
+	ALLOW_CALL(interruptMaskingLockProxyMock, destruct());
+
+	distortos::devices::AsynchronousBlockDevice asynchronousBlockDevice {blockDeviceMock};
+	REQUIRE(&asynchronousBlockDevice.getBlockDevice() == &blockDeviceMock);
+
+	std::vector<Type> completed;
+	distortos::devices::BlockDeviceRequest requests[]
+	{
+			distortos::devices::BlockDeviceRequest{callback, &completed},
+			distortos::devices::BlockDeviceRequest{callback, &completed},
+			distortos::devices::BlockDeviceRequest{callback, &completed},
+			distortos::devices::BlockDeviceRequest{},
+	};
+	uint8_t buffer[16];
+
+	SECTION("Failed submission should leave the request not pending")
+	{
+		requests[0].prepareSynchronize();
+		REQUIRE_CALL(semaphoreMock, tryWait()).IN_SEQUENCE(sequence).RETURN(EAGAIN);
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(EOVERFLOW);
+		REQUIRE(asynchronousBlockDevice.submit(requests[0]) == EOVERFLOW);
+		REQUIRE(requests[0].isPending() == false);
+	}
+	SECTION("Requests should be executed in order of submission, until stop is requested")
+	{
+		requests[0].prepareRead(0x1000, buffer, sizeof(buffer));
+		requests[1].prepareWrite(0x2000, buffer, sizeof(buffer));
+		requests[2].prepareErase(0x3000, 0x4000);
+		requests[3].prepareSynchronize();
+		REQUIRE(requests[1].getType() == Type::write);
+		REQUIRE(requests[1].getAddress() == 0x2000);
+		REQUIRE(requests[1].getBuffer() == buffer);
+		REQUIRE(requests[1].getSize() == sizeof(buffer));
+
+		for (auto& request : requests)
+		{
+			REQUIRE_CALL(semaphoreMock, tryWait()).IN_SEQUENCE(sequence).RETURN(EAGAIN);
+			REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE(asynchronousBlockDevice.submit(request) == 0);
+			REQUIRE(request.isPending() == true);
+		}
+
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE(asynchronousBlockDevice.stop() == 0);
+
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, read(uint64_t{0x1000}, buffer, sizeof(buffer))).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, write(uint64_t{0x2000}, buffer, sizeof(buffer))).IN_SEQUENCE(sequence)
+				.RETURN(EIO);
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, erase(uint64_t{0x3000}, uint64_t{0x4000})).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, synchronize()).IN_SEQUENCE(sequence).RETURN(ENOSPC);
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		asynchronousBlockDevice.run();
+
+		REQUIRE(completed == (std::vector<Type>{Type::read, Type::write, Type::erase}));
+		const int results[] {0, EIO, 0, ENOSPC};
+		for (size_t i {}; i < sizeof(results) / sizeof(*results); ++i)
+		{
+			REQUIRE(requests[i].isPending() == false);
+			REQUIRE(requests[i].getResult() == results[i]);
+		}
+
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE(requests[1].wait() == EIO);
+	}
+	SECTION("Request resubmitted from its callback should be completed only after the last execution")
+	{
+		ResubmissionContext context {&asynchronousBlockDevice, {}, 1};
+		distortos::devices::BlockDeviceRequest request {resubmittingCallback, &context};
+		request.prepareRead(0x1000, buffer, sizeof(buffer));
+
+		REQUIRE_CALL(semaphoreMock, tryWait()).IN_SEQUENCE(sequence).RETURN(EAGAIN);
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE(asynchronousBlockDevice.submit(request) == 0);
+
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE(asynchronousBlockDevice.stop() == 0);
+
+		// resubmission must neither drop nor signal completion of the request
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, read(uint64_t{0x1000}, buffer, sizeof(buffer))).IN_SEQUENCE(sequence).RETURN(EIO);
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, read(uint64_t{0x1000 + sizeof(buffer)}, buffer, sizeof(buffer)))
+				.IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		asynchronousBlockDevice.run();
+
+		REQUIRE(context.results == (std::vector<int>{EIO, 0}));
+		REQUIRE(context.resubmissions == 0);
+		REQUIRE(request.isPending() == false);
+
+		REQUIRE_CALL(semaphoreMock, wait()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE(request.wait() == 0);
+	}
+}
@@ -40,6 +40,7 @@ public:
 	MAKE_MOCK0(synchronize, int());
 	MAKE_MOCK0(unlock, void());
 	MAKE_MOCK3(write, int(uint64_t, const void*, size_t));
+	MAKE_MOCK2(writeGather, int(uint64_t, distortos::devices::WriteSegmentsRange));
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -2220,3 +2221,135 @@ TEST_CASE("Testing synchronize()", "[synchronize]")
 	REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
 	REQUIRE(bufferingBlockDevice.close() == 0);
 }
+
+TEST_CASE("Testing writeGather()", "[writeGather]")
+{
+	BlockDevice blockDeviceMock;
+	uint8_t readBuffer[blockSize * 8] __attribute__ ((aligned(alignment))) {};
+	uint8_t writeBuffer[blockSize * 8] __attribute__ ((aligned(alignment))) {};
+	trompeloeil::sequence sequence {};
+
+	constexpr auto readBufferSize = sizeof(readBuffer);
+	constexpr auto writeBufferSize = sizeof(writeBuffer);
+
+	distortos::devices::BufferingBlockDevice bufferingBlockDevice {blockDeviceMock, readBuffer, readBufferSize,
+			writeBuffer, writeBufferSize};
+	std::vector<std::unique_ptr<trompeloeil::expectation>> expectations {};
+
+	REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+	REQUIRE_CALL(blockDeviceMock, open()).IN_SEQUENCE(sequence).RETURN(0);
+	REQUIRE_CALL(blockDeviceMock, getBlockSize()).IN_SEQUENCE(sequence).RETURN(blockSize);
+	REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+	REQUIRE(bufferingBlockDevice.open() == 0);
+
+	constexpr uint64_t address {0x1c5e0f93 * blockSize};
+
+	SECTION("Segments smaller than write buffer should be collected in write buffer")
+	{
+		const distortos::devices::WriteSegment segments[]
+		{
+				{randomData, 2 * blockSize},
+				{randomData + 2 * blockSize, 3 * blockSize},
+		};
+
+		REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+		for (size_t i {}; i < sizeof(segments) / sizeof(*segments); ++i)
+		{
+			expectations.emplace_back(NAMED_REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence));
+			expectations.emplace_back(NAMED_REQUIRE_CALL(blockDeviceMock, getBlockSize()).IN_SEQUENCE(sequence)
+					.RETURN(blockSize));
+			expectations.emplace_back(NAMED_REQUIRE_CALL(blockDeviceMock, getSize()).IN_SEQUENCE(sequence)
+					.RETURN(deviceSize));
+			expectations.emplace_back(NAMED_REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence));
+		}
+		REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+		REQUIRE(bufferingBlockDevice.writeGather(address, distortos::devices::WriteSegmentsRange{segments}) == 0);
+
+		REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(blockDeviceMock, write(address, writeBuffer, 5 * blockSize))
+				.WITH(memcmp(_2, randomData, _3) == 0).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, synchronize()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+		REQUIRE(bufferingBlockDevice.synchronize() == 0);
+	}
+	SECTION("Segments not smaller than write buffer should be passed to block device")
+	{
+		const distortos::devices::WriteSegment segments[]
+		{
+				{randomData + 5 * blockSize, 3 * blockSize},
+				{randomData + 20 * blockSize, 5 * blockSize},
+		};
+		const auto segmentsMatcher = [&segments](const distortos::devices::WriteSegmentsRange range)
+				{
+					return range.begin() == segments && range.size() == sizeof(segments) / sizeof(*segments);
+				};
+
+		for (const auto overlap : {false, true})
+			DYNAMIC_SECTION("Write buffer " << (overlap == false ? "not " : "") << "overlapping written range")
+			{
+				const auto bufferedAddress = overlap == false ? address + 8 * blockSize : address + 6 * blockSize;
+
+				REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+				REQUIRE_CALL(blockDeviceMock, getBlockSize()).IN_SEQUENCE(sequence).RETURN(blockSize);
+				REQUIRE_CALL(blockDeviceMock, getSize()).IN_SEQUENCE(sequence).RETURN(deviceSize);
+				REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+				REQUIRE(bufferingBlockDevice.write(bufferedAddress, randomData, 2 * blockSize) == 0);
+
+				REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+				REQUIRE_CALL(blockDeviceMock, getBlockSize()).IN_SEQUENCE(sequence).RETURN(blockSize);
+				REQUIRE_CALL(blockDeviceMock, getSize()).IN_SEQUENCE(sequence).RETURN(deviceSize);
+				if (overlap == true)
+					expectations.emplace_back(NAMED_REQUIRE_CALL(blockDeviceMock,
+							write(bufferedAddress, writeBuffer, 2 * blockSize))
+							.WITH(memcmp(_2, randomData, _3) == 0).IN_SEQUENCE(sequence).RETURN(0));
+				REQUIRE_CALL(blockDeviceMock, writeGather(address, _)).WITH(segmentsMatcher(_2))
+						.IN_SEQUENCE(sequence).RETURN(0);
+				REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+				REQUIRE(bufferingBlockDevice.writeGather(address, distortos::devices::WriteSegmentsRange{segments}) ==
+						0);
+
+				REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+				if (overlap == false)
+					expectations.emplace_back(NAMED_REQUIRE_CALL(blockDeviceMock,
+							write(bufferedAddress, writeBuffer, 2 * blockSize))
+							.WITH(memcmp(_2, randomData, _3) == 0).IN_SEQUENCE(sequence).RETURN(0));
+				REQUIRE_CALL(blockDeviceMock, synchronize()).IN_SEQUENCE(sequence).RETURN(0);
+				REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+				REQUIRE(bufferingBlockDevice.synchronize() == 0);
+			}
+	}
+	SECTION("Write buffer flush error should propagate error code to caller")
+	{
+		const distortos::devices::WriteSegment segments[]
+		{
+				{randomData, 8 * blockSize},
+		};
+
+		REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(blockDeviceMock, getBlockSize()).IN_SEQUENCE(sequence).RETURN(blockSize);
+		REQUIRE_CALL(blockDeviceMock, getSize()).IN_SEQUENCE(sequence).RETURN(deviceSize);
+		REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+		REQUIRE(bufferingBlockDevice.write(address, randomData, blockSize) == 0);
+
+		REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(blockDeviceMock, getBlockSize()).IN_SEQUENCE(sequence).RETURN(blockSize);
+		REQUIRE_CALL(blockDeviceMock, getSize()).IN_SEQUENCE(sequence).RETURN(deviceSize);
+		constexpr int ret {0x2f9d1b4a};
+		REQUIRE_CALL(blockDeviceMock, write(address, writeBuffer, blockSize)).IN_SEQUENCE(sequence).RETURN(ret);
+		REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+		REQUIRE(bufferingBlockDevice.writeGather(address, distortos::devices::WriteSegmentsRange{segments}) == ret);
+
+		REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(blockDeviceMock, write(address, writeBuffer, blockSize)).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, synchronize()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+		REQUIRE(bufferingBlockDevice.synchronize() == 0);
+	}
+
+	REQUIRE_CALL(blockDeviceMock, lock()).IN_SEQUENCE(sequence);
+	REQUIRE_CALL(blockDeviceMock, close()).IN_SEQUENCE(sequence).RETURN(0);
+	REQUIRE_CALL(blockDeviceMock, unlock()).IN_SEQUENCE(sequence);
+	REQUIRE(bufferingBlockDevice.close() == 0);
+}
@@ -0,0 +1,226 @@
+/**
+ * \file
+ * \brief CompareMatchTickSource test cases
+ *
+ * This test checks whether CompareMatchTickSource generates correct number of ticks without cumulative drift, handles
+ * wrap-around of narrow counters and does not miss compare-match when the counter passes new compare value before it
+ * is written. It also checks whether the time since tick is measured from the nominal instant of the tick.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/CompareMatchTickSource.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <algorithm>
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of calls to TickSource::handleTick()
+size_t ticks;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// TestTickSource class is a CompareMatchTickSource with simulated counter
+class TestTickSource : public distortos::CompareMatchTickSource
+{
+public:
+
+	/**
+	 * \brief TestTickSource's constructor
+	 *
+	 * \param [in] counterFrequency is the frequency of counter, Hz
+	 * \param [in] counterMask is the mask of valid bits of counter
+	 * \param [in] counter is the initial value of counter
+	 */
+
+	TestTickSource(const uint32_t counterFrequency, const uint32_t counterMask, const uint32_t counter) :
+			CompareMatchTickSource{counterFrequency, counterMask},
+			compare_{},
+			counter_{counter},
+			counterMask_{counterMask},
+			setCompareDelay_{},
+			started_{}
+	{
+
+	}
+
+	/**
+	 * \brief Advances simulated counter, calling interruptHandler() each time it matches compare register.
+	 *
+	 * \param [in] cycles is the number of counter's cycles by which the counter will be advanced
+	 */
+
+	void advance(uint32_t cycles)
+	{
+		while (cycles-- != 0)
+		{
+			counter_ = (counter_ + 1) & counterMask_;
+			if (counter_ == compare_)
+				interruptHandler();
+		}
+	}
+
+	/**
+	 * \return current value of compare register
+	 */
+
+	uint32_t getCompare() const
+	{
+		return compare_;
+	}
+
+	/**
+	 * \return true if startCounter() was called, false otherwise
+	 */
+
+	bool isStarted() const
+	{
+		return started_;
+	}
+
+	/**
+	 * \brief Sets number of cycles by which the counter advances while next compare value is written.
+	 *
+	 * \param [in] setCompareDelay is the number of cycles by which the counter advances in next setCompare()
+	 */
+
+	void setSetCompareDelay(const uint32_t setCompareDelay)
+	{
+		setCompareDelay_ = setCompareDelay;
+	}
+
+protected:
+
+	uint32_t getCounter() const override
+	{
+		return counter_;
+	}
+
+	void setCompare(const uint32_t compare) override
+	{
+		// simulate slow write - the counter passes new compare value, but compare-match is not generated
+		counter_ = (counter_ + setCompareDelay_) & counterMask_;
+		setCompareDelay_ = {};
+		compare_ = compare;
+	}
+
+	void startCounter() override
+	{
+		started_ = true;
+	}
+
+private:
+
+	/// simulated compare register
+	uint32_t compare_;
+
+	/// simulated counter
+	uint32_t counter_;
+
+	/// mask of valid bits of counter
+	uint32_t counterMask_;
+
+	/// number of cycles by which the counter advances in next setCompare()
+	uint32_t setCompareDelay_;
+
+	/// true if startCounter() was called, false otherwise
+	bool started_;
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void distortos::TickSource::handleTick()
+{
+	++ticks;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing start()", "[start]")
+{
+	TestTickSource tickSource {1000000, 0xffffffff, 1234};
+	tickSource.start();
+	REQUIRE(tickSource.isStarted() == true);
+	REQUIRE(tickSource.getCompare() == 1234 + 1000000 / DISTORTOS_TICK_FREQUENCY);
+	REQUIRE(tickSource.getTimeSinceTick() == std::chrono::nanoseconds{});
+}
+
+TEST_CASE("Testing interruptHandler() and getTimeSinceTick()", "[interruptHandler][getTimeSinceTick]")
+{
+	ticks = {};
+
+	SECTION("Integer number of counter's cycles per tick")
+	{
+		TestTickSource tickSource {1000000, 0xffffffff, 0xffff0000};
+		tickSource.start();
+		tickSource.advance(999);
+		REQUIRE(ticks == 0);
+		REQUIRE(tickSource.getTimeSinceTick() == std::chrono::microseconds{999});
+		tickSource.advance(1);
+		REQUIRE(ticks == 1);
+		REQUIRE(tickSource.getTimeSinceTick() == std::chrono::nanoseconds{});
+		// wrap-around of 32-bit counter
+		tickSource.advance(1000000);
+		REQUIRE(ticks == 1 + DISTORTOS_TICK_FREQUENCY);
+	}
+	SECTION("Fractional number of counter's cycles per tick, 16-bit counter")
+	{
+		TestTickSource tickSource {32768, 0xffff, 0xfff0};
+		tickSource.start();
+		// 10 seconds - counter wraps around several times, there should be no cumulative drift
+		tickSource.advance(32768 * 10);
+		REQUIRE(ticks == DISTORTOS_TICK_FREQUENCY * 10);
+		REQUIRE(tickSource.getCompare() == ((0xfff0 + 32768 * 10 + 32) & 0xffff));
+
+		// during next second time since start() must be measured exactly, except when the tick was handled before its
+		// nominal instant - then time must not go back across tick boundary
+		constexpr uint64_t nanosecondsPerSecond {1000000000};
+		constexpr std::chrono::nanoseconds tickPeriod {nanosecondsPerSecond / DISTORTOS_TICK_FREQUENCY};
+		std::chrono::nanoseconds previousNow {};
+		for (uint64_t cycles {32768 * 10 + 1}; cycles <= 32768 * 11; ++cycles)
+		{
+			tickSource.advance(1);
+			const std::chrono::nanoseconds tickInstant {tickPeriod * ticks};
+			const auto now = tickInstant + tickSource.getTimeSinceTick();
+			REQUIRE(now >= previousNow);
+			REQUIRE(now == std::max(tickInstant, std::chrono::nanoseconds{cycles * nanosecondsPerSecond / 32768}));
+			previousNow = now;
+		}
+		REQUIRE(ticks == DISTORTOS_TICK_FREQUENCY * 11);
+	}
+	SECTION("Compare value passed by the counter before it was written")
+	{
+		TestTickSource tickSource {1000000, 0xffff, 0};
+		tickSource.start();
+		tickSource.advance(999);
+		// counter passes new compare value while it is being written - the tick must be handled immediately
+		tickSource.setSetCompareDelay(1001);
+		tickSource.advance(1);
+		REQUIRE(ticks == 2);
+		REQUIRE(tickSource.getCompare() == 3000);
+		REQUIRE(tickSource.getTimeSinceTick() == std::chrono::microseconds{1});
+		tickSource.advance(999);
+		REQUIRE(ticks == 3);
+	}
+}
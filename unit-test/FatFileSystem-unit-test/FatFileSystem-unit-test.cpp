@@ -75,6 +75,7 @@ public:
 	MAKE_MOCK4(ufat_dir_read, int(ufat_directory*, ufat_dirent*, char*, int));
 	MAKE_MOCK1(ufat_dir_rewind, void(ufat_directory*));
 	MAKE_MOCK2(ufat_file_advance, int(ufat_file*, ufat_size_t));
+	MAKE_MOCK2(ufat_file_fill, int(ufat_file*, ufat_size_t));
 	MAKE_MOCK3(ufat_file_read, int(ufat_file*, void*, ufat_size_t));
 	MAKE_MOCK1(ufat_file_rewind, void(ufat_file*));
 	MAKE_MOCK1(ufat_file_truncate, int(ufat_file*));
@@ -85,6 +86,7 @@ public:
 	MAKE_MOCK2(ufat_open_root, void(ufat*, ufat_directory*));
 	MAKE_MOCK3(ufat_open_subdir, int(ufat*, ufat_directory*, const ufat_dirent*));
 	MAKE_MOCK2(ufat_open, int(ufat*, const ufat_device*));
+	MAKE_MOCK2(ufat_set_bitmap, void(ufat*, uint32_t*));
 	MAKE_MOCK1(ufat_sync, int(ufat*));
 
 	static UfatMock& getInstance()
@@ -163,6 +165,11 @@ extern "C" int ufat_file_advance(ufat_file* const file, const ufat_size_t offset
 	return UfatMock::getInstance().ufat_file_advance(file, offset);
 }
 
+extern "C" int ufat_file_fill(ufat_file* const file, const ufat_size_t size)
+{
+	return UfatMock::getInstance().ufat_file_fill(file, size);
+}
+
 extern "C" int ufat_file_read(ufat_file* const file, void* const buffer, const ufat_size_t size)
 {
 	return UfatMock::getInstance().ufat_file_read(file, buffer, size);
@@ -214,6 +221,11 @@ extern "C" int ufat_open(ufat* const fileSystem, const ufat_device* const device
 	return UfatMock::getInstance().ufat_open(fileSystem, device);
 }
 
+extern "C" void ufat_set_bitmap(ufat* const fileSystem, uint32_t* const bitmap)
+{
+	return UfatMock::getInstance().ufat_set_bitmap(fileSystem, bitmap);
+}
+
 extern "C" int ufat_sync(ufat* const fileSystem)
 {
 	return UfatMock::getInstance().ufat_sync(fileSystem);
@@ -386,6 +398,38 @@ TEST_CASE("Testing mount() & unmount()", "[mount/unmount]")
 			REQUIRE(ffs.unmount() == ret);
 		}
 	}
+
+	static const std::tuple<size_t, bool, const char*> bitmapAssociations[]
+	{
+			{0, false, "disabled free-cluster bitmap"},
+			{1999, false, "too small max size of free-cluster bitmap"},
+			{2000, true, "max size of free-cluster bitmap equal to required size"},
+			{3000, true, "max size of free-cluster bitmap greater than required size"},
+	};
+	for (const auto& [maxBitmapSize, bitmap, description] : bitmapAssociations)
+		DYNAMIC_SECTION("Testing with " << description)
+		{
+			distortos::FatFileSystem ffs {blockDeviceMock, {}, {}, maxBitmapSize};
+
+			ufat* ufatFileSystem {};
+
+			REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE_CALL(blockDeviceMock, open()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE_CALL(blockDeviceMock, getBlockSize()).IN_SEQUENCE(sequence).RETURN(defaultBlockSize);
+			REQUIRE_CALL(ufatMock, ufat_open(ne(nullptr), ne(nullptr))).IN_SEQUENCE(sequence)
+					.LR_SIDE_EFFECT(ufatFileSystem = _1).SIDE_EFFECT(_1->bpb.num_clusters = 2000 * 8 - 31).RETURN(0);
+			if (bitmap == true)
+				expectations.emplace_back(NAMED_REQUIRE_CALL(ufatMock, ufat_set_bitmap(_, ne(nullptr)))
+						.LR_WITH(_1 == ufatFileSystem).IN_SEQUENCE(sequence));
+			REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE(ffs.mount() == 0);
+
+			REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE_CALL(ufatMock, ufat_close(ufatFileSystem)).IN_SEQUENCE(sequence);
+			REQUIRE_CALL(blockDeviceMock, close()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE(ffs.unmount() == 0);
+		}
 }
 
 TEST_CASE("Testing getFileStatus()", "[getFileStatus]")
@@ -1554,10 +1598,141 @@ TEST_CASE("Testing openFile()", "[openFile]")
 							REQUIRE(currentPosition == initialPosition + expectedBytesRead);
 						}
 					}
+					SECTION("Testing successful readAt()")
+					{
+						uint8_t buffer[15] {};
+						constexpr size_t expectedBytesRead {sizeof(buffer) / 2};
+						constexpr uint32_t offset {0x100};
+
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(ufatMock, ufat_file_advance(ufatFile, offset)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos += _2).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(ufatMock, ufat_file_read(ufatFile, buffer, sizeof(buffer)))
+									.IN_SEQUENCE(sequence).SIDE_EFFECT(_1->cur_pos += expectedBytesRead)
+									.RETURN(expectedBytesRead);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(ufatMock, ufat_file_rewind(ufatFile)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos = {});
+							REQUIRE_CALL(ufatMock, ufat_file_advance(ufatFile, initialPosition)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos += _2).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							const auto [ret, bytesRead] =
+									file->readAt(initialPosition + offset, buffer, sizeof(buffer));
+							REQUIRE(ret == 0);
+							REQUIRE(bytesRead == expectedBytesRead);
+						}
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							const auto [ret, currentPosition] = file->getPosition();
+							REQUIRE(ret == 0);
+							REQUIRE(currentPosition == initialPosition);
+						}
+					}
 				}
 
 				if (writable == true)
 				{
+					SECTION("allocate() with negative offset or non-positive length should fail with EINVAL")
+					{
+						static const std::pair<off_t, off_t> invalidAssociations[]
+						{
+								{-1, 1},
+								{0, 0},
+								{0, -1},
+						};
+						for (const auto& [offset, length] : invalidAssociations)
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE(file->allocate(offset, length) == EINVAL);
+						}
+					}
+					SECTION("allocate() beyond max size of file should fail with EFBIG")
+					{
+						REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+						REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+						REQUIRE(file->allocate(UINT32_MAX, 1) == EFBIG);
+					}
+					SECTION("allocate() within the file should perform no action")
+					{
+						REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+						REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+						REQUIRE(file->allocate(fileSize / 2, fileSize / 2) == 0);
+					}
+					SECTION("ufat_file_fill() error should propagate converted error code to caller")
+					{
+						constexpr off_t offset {fileSize - 0x4e2};
+						constexpr off_t length {0x9c3};
+
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(ufatMock, ufat_file_advance(ufatFile, fileSize - initialPosition))
+									.IN_SEQUENCE(sequence).SIDE_EFFECT(_1->cur_pos += _2).RETURN(0);
+							REQUIRE_CALL(ufatMock, ufat_file_fill(ufatFile, offset + length - fileSize))
+									.IN_SEQUENCE(sequence).RETURN(-UFAT_ERR_NO_CLUSTERS);
+							REQUIRE_CALL(ufatMock, ufat_file_rewind(ufatFile)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos = {});
+							REQUIRE_CALL(ufatMock, ufat_file_advance(ufatFile, initialPosition)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos += _2).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE(file->allocate(offset, length) == ENOSPC);
+						}
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							const auto [ret, currentPosition] = file->getPosition();
+							REQUIRE(ret == 0);
+							REQUIRE(currentPosition == initialPosition);
+						}
+
+						dirty = true;
+					}
+					SECTION("Testing successful allocate()")
+					{
+						constexpr off_t offset {fileSize + 0x1d7};
+						constexpr off_t length {0x3e8a};
+
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(ufatMock, ufat_file_advance(ufatFile, fileSize - initialPosition))
+									.IN_SEQUENCE(sequence).SIDE_EFFECT(_1->cur_pos += _2).RETURN(0);
+							REQUIRE_CALL(ufatMock, ufat_file_fill(ufatFile, offset + length - fileSize))
+									.IN_SEQUENCE(sequence).SIDE_EFFECT(_1->cur_pos += _2)
+									.SIDE_EFFECT(_1->file_size = _1->cur_pos).RETURN(_2);
+							REQUIRE_CALL(ufatMock, ufat_file_rewind(ufatFile)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos = {});
+							REQUIRE_CALL(ufatMock, ufat_file_advance(ufatFile, initialPosition)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos += _2).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE(file->allocate(offset, length) == 0);
+						}
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							const auto [ret, currentPosition] = file->getPosition();
+							REQUIRE(ret == 0);
+							REQUIRE(currentPosition == initialPosition);
+						}
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							const auto [ret, size] = file->getSize();
+							REQUIRE(ret == 0);
+							REQUIRE(size == offset + length);
+						}
+
+						dirty = true;
+					}
+
 					if (appendMode == true)
 					{
 						SECTION("ufat_file_advance() error should propagate converted error code to caller")
@@ -1640,6 +1815,51 @@ TEST_CASE("Testing openFile()", "[openFile]")
 							REQUIRE(currentPosition == expectedPosition);
 						}
 
+						dirty = true;
+					}
+					SECTION("Testing successful writeAt()")
+					{
+						const uint8_t buffer[79] {};
+						constexpr size_t expectedBytesWritten {sizeof(buffer) / 2};
+						constexpr uint32_t offset {0x100};
+
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(ufatMock, ufat_file_advance(ufatFile, offset)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos += _2).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							if (appendMode == true)
+								expectations.emplace_back(NAMED_REQUIRE_CALL(ufatMock,
+										ufat_file_advance(ufatFile, fileSize - initialPosition - offset))
+										.IN_SEQUENCE(sequence).SIDE_EFFECT(_1->cur_pos += _2).RETURN(0));
+							REQUIRE_CALL(ufatMock, ufat_file_write(ufatFile, buffer, sizeof(buffer)))
+									.IN_SEQUENCE(sequence).SIDE_EFFECT(_1->cur_pos += expectedBytesWritten)
+									.RETURN(expectedBytesWritten);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(ufatMock, ufat_file_rewind(ufatFile)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos = {});
+							REQUIRE_CALL(ufatMock, ufat_file_advance(ufatFile, initialPosition)).IN_SEQUENCE(sequence)
+									.SIDE_EFFECT(_1->cur_pos += _2).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							const auto [ret, bytesWritten] =
+									file->writeAt(initialPosition + offset, buffer, sizeof(buffer));
+							REQUIRE(ret == 0);
+							REQUIRE(bytesWritten == expectedBytesWritten);
+						}
+						{
+							REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+							REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+							const auto [ret, currentPosition] = file->getPosition();
+							REQUIRE(ret == 0);
+							REQUIRE(currentPosition == initialPosition);
+						}
+
 						dirty = true;
 					}
 				}
@@ -1748,9 +1968,9 @@ TEST_CASE("Testing openFile()", "[openFile]")
 												const uint8_t buffer[44] {};
 
 												REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
-												REQUIRE_CALL(ufatMock, ufat_file_write(ufatFile, ne(nullptr), 1u))
-														.WITH(*reinterpret_cast<const uint8_t*>(_2) == 0)
-														.IN_SEQUENCE(sequence).RETURN(-UFAT_ERR_DIRECTORY_FULL);
+												REQUIRE_CALL(ufatMock, ufat_file_fill(ufatFile,
+														static_cast<ufat_size_t>(pastTheEnd))).IN_SEQUENCE(sequence)
+														.RETURN(-UFAT_ERR_DIRECTORY_FULL);
 												REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
 												const auto [ret, bytesWritten] = file->write(buffer, sizeof(buffer));
 												REQUIRE(ret == ENOSPC);
@@ -1777,12 +1997,11 @@ TEST_CASE("Testing openFile()", "[openFile]")
 												expectations.emplace_back(NAMED_REQUIRE_CALL(ufatMock,
 														ufat_file_advance(ufatFile, 0u)).IN_SEQUENCE(sequence)
 														.SIDE_EFFECT(_1->cur_pos += _2).RETURN(0));
-											for (off_t i {}; i < pastTheEnd * (appendMode == false); ++i)
+											if (appendMode == false)
 												expectations.emplace_back(NAMED_REQUIRE_CALL(ufatMock,
-														ufat_file_write(ufatFile, ne(nullptr), 1u))
-														.WITH(*reinterpret_cast<const uint8_t*>(_2) == 0)
-														.IN_SEQUENCE(sequence).SIDE_EFFECT(_1->cur_pos += _3)
-														.RETURN(_3));
+														ufat_file_fill(ufatFile, static_cast<ufat_size_t>(pastTheEnd)))
+														.IN_SEQUENCE(sequence).SIDE_EFFECT(_1->cur_pos += _2)
+														.RETURN(_2));
 											REQUIRE_CALL(ufatMock, ufat_file_write(ufatFile, buffer, sizeof(buffer)))
 													.IN_SEQUENCE(sequence)
 													.SIDE_EFFECT(_1->cur_pos += expectedBytesWritten)
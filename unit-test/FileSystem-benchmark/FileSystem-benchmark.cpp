@@ -0,0 +1,555 @@
+/**
+ * \file
+ * \brief File system benchmark
+ *
+ * This benchmark executes the same workloads on FatFileSystem (directly on RamBlockDevice and through
+ * BufferingBlockDevice) and on Littlefs1FileSystem and Littlefs2FileSystem (on RamMemoryTechnologyDevice which emulates
+ * SPI NOR flash memory). For each workload it prints the time measured on the host, the time which would be spent by
+ * emulated flash memory and the amount of data read, written and erased on the device. All data is verified, so the
+ * benchmark also checks whether file systems work with real uFAT and littlefs.
+ *
+ * If `DISTORTOS_BENCHMARK_IMAGE_DIRECTORY` environment variable is set, contents of devices are stored in files
+ * `<directory>/<name>.img` (mapped to memory), which may be inspected after the benchmark.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/devices/memory/BufferingBlockDevice.hpp"
+#include "distortos/devices/memory/RamBlockDevice.hpp"
+#include "distortos/devices/memory/RamMemoryTechnologyDevice.hpp"
+
+#include "distortos/FileSystem/FatFileSystem.hpp"
+#include "distortos/FileSystem/File.hpp"
+#include "distortos/FileSystem/Littlefs1FileSystem.hpp"
+#include "distortos/FileSystem/Littlefs2FileSystem.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+using distortos::devices::RamMemoryTechnologyDevice;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// common subset of statistics of RamBlockDevice and RamMemoryTechnologyDevice
+struct DeviceStatistics
+{
+	/// total time that real device would spend on executed operations
+	std::chrono::nanoseconds busyTime;
+
+	/// number of bytes erased
+	uint64_t erasedBytes;
+
+	/// number of bytes read
+	uint64_t readBytes;
+
+	/// number of bytes written or programmed
+	uint64_t writtenBytes;
+};
+
+/// memory buffer with contents of device, optionally backed by a file mapped to memory
+class Storage
+{
+public:
+
+	Storage(const char* const name, const size_t size) :
+			vector_{},
+			data_{},
+			size_{size},
+			fileDescriptor_{-1}
+	{
+		const auto directory = getenv("DISTORTOS_BENCHMARK_IMAGE_DIRECTORY");
+		if (directory == nullptr)
+		{
+			vector_.resize(size_, 0xff);
+			data_ = vector_.data();
+			return;
+		}
+
+		const auto path = std::string{directory} + '/' + name + ".img";
+		fileDescriptor_ = open(path.data(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+		REQUIRE(fileDescriptor_ != -1);
+		REQUIRE(ftruncate(fileDescriptor_, size_) == 0);
+		data_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor_, 0);
+		REQUIRE(data_ != MAP_FAILED);
+		memset(data_, 0xff, size_);
+	}
+
+	~Storage()
+	{
+		if (fileDescriptor_ == -1)
+			return;
+
+		munmap(data_, size_);
+		close(fileDescriptor_);
+	}
+
+	void* getData() const
+	{
+		return data_;
+	}
+
+	size_t getSize() const
+	{
+		return size_;
+	}
+
+	Storage(const Storage&) = delete;
+	Storage& operator=(const Storage&) = delete;
+
+private:
+
+	std::vector<uint8_t> vector_;
+	void* data_;
+	size_t size_;
+	int fileDescriptor_;
+};
+
+/// file system on a device, together with all the objects it needs
+class Target
+{
+public:
+
+	explicit Target(const char* const name) :
+			name_{name}
+	{
+
+	}
+
+	virtual ~Target() = default;
+
+	virtual distortos::FileSystem& getFileSystem() = 0;
+
+	const char* getName() const
+	{
+		return name_;
+	}
+
+	virtual DeviceStatistics getStatistics() = 0;
+
+	virtual void resetStatistics() = 0;
+
+private:
+
+	const char* name_;
+};
+
+/// FatFileSystem on RamBlockDevice, optionally through BufferingBlockDevice
+class FatTarget : public Target
+{
+public:
+
+	FatTarget(const char* const name, const bool buffering) :
+			Target{name},
+			storage_{name, deviceSize},
+			ramBlockDevice_{storage_.getData(), storage_.getSize()},
+			bufferingBlockDevice_{ramBlockDevice_, readBuffer_, sizeof(readBuffer_), writeBuffer_,
+					sizeof(writeBuffer_)},
+			fileSystem_{buffering == true ? static_cast<distortos::devices::BlockDevice&>(bufferingBlockDevice_) :
+					ramBlockDevice_}
+	{
+
+	}
+
+	distortos::FileSystem& getFileSystem() override
+	{
+		return fileSystem_;
+	}
+
+	DeviceStatistics getStatistics() override
+	{
+		const auto statistics = ramBlockDevice_.getStatistics();
+		return {{}, statistics.erasedBytes, statistics.readBytes, statistics.writtenBytes};
+	}
+
+	void resetStatistics() override
+	{
+		ramBlockDevice_.resetStatistics();
+	}
+
+private:
+
+	constexpr static size_t deviceSize {4 * 1024 * 1024};
+
+	Storage storage_;
+	distortos::devices::RamBlockDevice ramBlockDevice_;
+	alignas(DISTORTOS_BLOCKDEVICE_BUFFER_ALIGNMENT) uint8_t readBuffer_[4096];
+	alignas(DISTORTOS_BLOCKDEVICE_BUFFER_ALIGNMENT) uint8_t writeBuffer_[4096];
+	distortos::devices::BufferingBlockDevice bufferingBlockDevice_;
+	distortos::FatFileSystem fileSystem_;
+};
+
+/// littlefs on RamMemoryTechnologyDevice which emulates SPI NOR flash memory
+template<typename FileSystem>
+class LittlefsTarget : public Target
+{
+public:
+
+	explicit LittlefsTarget(const char* const name) :
+			Target{name},
+			storage_{name, deviceSize},
+			eraseCounters_(deviceSize / eraseBlockSize),
+			ramMemoryTechnologyDevice_{storage_.getData(), storage_.getSize(), 16, 16, eraseBlockSize, timings,
+					eraseCounters_.data()},
+			fileSystem_{ramMemoryTechnologyDevice_}
+	{
+
+	}
+
+	distortos::FileSystem& getFileSystem() override
+	{
+		return fileSystem_;
+	}
+
+	DeviceStatistics getStatistics() override
+	{
+		const auto statistics = ramMemoryTechnologyDevice_.getStatistics();
+		return {statistics.busyTime, statistics.erasedBlocks * eraseBlockSize, statistics.readBytes,
+				statistics.programmedBytes};
+	}
+
+	void printWear() const
+	{
+		uint64_t total {};
+		uint32_t max {};
+		for (const auto eraseCounter : eraseCounters_)
+		{
+			total += eraseCounter;
+			max = std::max(max, eraseCounter);
+		}
+		printf("%-16s erase cycles per block: max %u, mean %.2f\n", getName(), static_cast<unsigned int>(max),
+				static_cast<double>(total) / eraseCounters_.size());
+	}
+
+	void resetStatistics() override
+	{
+		ramMemoryTechnologyDevice_.resetStatistics();
+	}
+
+private:
+
+	constexpr static size_t deviceSize {1024 * 1024};
+	constexpr static size_t eraseBlockSize {4096};
+
+	/// timings typical for SPI NOR flash: 4 kB sector erase in 45 ms, 256 B page program in 0.7 ms, 50 MHz clock
+	constexpr static RamMemoryTechnologyDevice::Timings timings {45ms, 44us, 3us};
+
+	Storage storage_;
+	std::vector<uint32_t> eraseCounters_;
+	RamMemoryTechnologyDevice ramMemoryTechnologyDevice_;
+	FileSystem fileSystem_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of chunk used in sequential workloads
+constexpr size_t sequentialChunkSize {4096};
+
+/// size of file used in sequential workloads
+constexpr size_t sequentialFileSize {256 * 1024};
+
+/// size of chunk used in random workloads
+constexpr size_t randomChunkSize {256};
+
+/// size of file used in random workloads
+constexpr size_t randomFileSize {64 * 1024};
+
+/// number of operations in random workloads
+constexpr size_t randomOperations {256};
+
+/// number of files used in small-file workloads
+constexpr size_t smallFiles {32};
+
+/// size of each file used in small-file workloads
+constexpr size_t smallFileSize {200};
+
+/// number of files written concurrently in fragmentation workload
+constexpr size_t fragmentedFiles {16};
+
+/// number of chunks appended to each file in fragmentation workload
+constexpr size_t fragmentedChunks {8};
+
+/// size of each chunk appended in fragmentation workload
+constexpr size_t fragmentedChunkSize {1024};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Generates deterministic contents of a file.
+ *
+ * \param [in] size is the size of generated data, bytes
+ * \param [in] seed is the seed of pseudo-random generator
+ *
+ * \return vector with generated data
+ */
+
+std::vector<uint8_t> generateData(const size_t size, const uint32_t seed)
+{
+	std::minstd_rand generator {seed};
+	std::vector<uint8_t> data(size);
+	for (auto& byte : data)
+		byte = generator();
+	return data;
+}
+
+/**
+ * \brief Executes one workload and prints its results.
+ *
+ * \tparam Function is the type of function object with workload
+ *
+ * \param [in] target is a reference to target on which the workload is executed
+ * \param [in] workloadName is the name of workload
+ * \param [in] function is the function object with workload, it is called with a reference to file system
+ */
+
+template<typename Function>
+void measure(Target& target, const char* const workloadName, Function&& function)
+{
+	target.resetStatistics();
+	const auto begin = std::chrono::steady_clock::now();
+	function(target.getFileSystem());
+	const std::chrono::duration<double, std::milli> hostTime {std::chrono::steady_clock::now() - begin};
+	const auto statistics = target.getStatistics();
+	const std::chrono::duration<double, std::milli> busyTime {statistics.busyTime};
+
+	printf("%-16s %-22s %10.3f %12.3f %11llu %11llu %11llu\n", target.getName(), workloadName, hostTime.count(),
+			busyTime.count(), static_cast<unsigned long long>(statistics.readBytes / 1024),
+			static_cast<unsigned long long>(statistics.writtenBytes / 1024),
+			static_cast<unsigned long long>(statistics.erasedBytes / 1024));
+}
+
+/**
+ * \brief Opens a file and checks the result.
+ *
+ * \param [in] fileSystem is a reference to file system
+ * \param [in] path is the path of file
+ * \param [in] flags are the flags of opened file
+ *
+ * \return opened file
+ */
+
+std::unique_ptr<distortos::File> openFile(distortos::FileSystem& fileSystem, const char* const path, const int flags)
+{
+	int ret;
+	std::unique_ptr<distortos::File> file;
+	std::tie(ret, file) = fileSystem.openFile(path, flags);
+	REQUIRE(ret == 0);
+	REQUIRE(file != nullptr);
+	return file;
+}
+
+/**
+ * \brief Reads whole file and compares it with expected contents.
+ *
+ * \param [in] fileSystem is a reference to file system
+ * \param [in] path is the path of file
+ * \param [in] expected is the expected contents of file
+ * \param [in] chunkSize is the size of chunk used for reading, bytes
+ */
+
+void readAndVerify(distortos::FileSystem& fileSystem, const char* const path, const std::vector<uint8_t>& expected,
+		const size_t chunkSize)
+{
+	const auto file = openFile(fileSystem, path, O_RDONLY);
+	std::vector<uint8_t> buffer(chunkSize);
+	for (size_t offset {}; offset < expected.size(); offset += chunkSize)
+	{
+		const auto size = std::min(chunkSize, expected.size() - offset);
+		const auto ret = file->read(buffer.data(), size);
+		REQUIRE(ret.first == 0);
+		REQUIRE(ret.second == size);
+		REQUIRE(memcmp(buffer.data(), expected.data() + offset, size) == 0);
+	}
+	REQUIRE(file->close() == 0);
+}
+
+/**
+ * \brief Writes whole file.
+ *
+ * \param [in] fileSystem is a reference to file system
+ * \param [in] path is the path of file
+ * \param [in] data is the contents of file
+ * \param [in] chunkSize is the size of chunk used for writing, bytes
+ */
+
+void write(distortos::FileSystem& fileSystem, const char* const path, const std::vector<uint8_t>& data,
+		const size_t chunkSize)
+{
+	const auto file = openFile(fileSystem, path, O_WRONLY | O_CREAT | O_TRUNC);
+	for (size_t offset {}; offset < data.size(); offset += chunkSize)
+	{
+		const auto size = std::min(chunkSize, data.size() - offset);
+		const auto ret = file->write(data.data() + offset, size);
+		REQUIRE(ret.first == 0);
+		REQUIRE(ret.second == size);
+	}
+	REQUIRE(file->close() == 0);
+}
+
+/**
+ * \brief Executes all workloads on one target.
+ *
+ * \param [in] target is a reference to target on which the workloads are executed
+ */
+
+void runBenchmark(Target& target)
+{
+	measure(target, "format", [](distortos::FileSystem& fileSystem)
+			{
+				REQUIRE(fileSystem.format() == 0);
+			});
+	measure(target, "mount (empty)", [](distortos::FileSystem& fileSystem)
+			{
+				REQUIRE(fileSystem.mount() == 0);
+			});
+
+	const auto sequentialData = generateData(sequentialFileSize, 1);
+	measure(target, "sequential write", [&sequentialData](distortos::FileSystem& fileSystem)
+			{
+				write(fileSystem, "seq.bin", sequentialData, sequentialChunkSize);
+			});
+	measure(target, "sequential read", [&sequentialData](distortos::FileSystem& fileSystem)
+			{
+				readAndVerify(fileSystem, "seq.bin", sequentialData, sequentialChunkSize);
+			});
+
+	auto randomData = generateData(randomFileSize, 2);
+	write(target.getFileSystem(), "rnd.bin", randomData, sequentialChunkSize);
+	measure(target, "random write", [&randomData](distortos::FileSystem& fileSystem)
+			{
+				std::minstd_rand generator {3};
+				const auto file = openFile(fileSystem, "rnd.bin", O_RDWR);
+				for (size_t i {}; i < randomOperations; ++i)
+				{
+					const auto offset = generator() % (randomFileSize / randomChunkSize) * randomChunkSize;
+					for (size_t j {}; j < randomChunkSize; ++j)
+						randomData[offset + j] = generator();
+					const auto ret = file->writeAt(offset, randomData.data() + offset, randomChunkSize);
+					REQUIRE(ret.first == 0);
+					REQUIRE(ret.second == randomChunkSize);
+				}
+				REQUIRE(file->close() == 0);
+			});
+	measure(target, "random read", [&randomData](distortos::FileSystem& fileSystem)
+			{
+				std::minstd_rand generator {4};
+				const auto file = openFile(fileSystem, "rnd.bin", O_RDONLY);
+				uint8_t buffer[randomChunkSize];
+				for (size_t i {}; i < randomOperations; ++i)
+				{
+					const auto offset = generator() % (randomFileSize / randomChunkSize) * randomChunkSize;
+					const auto ret = file->readAt(offset, buffer, sizeof(buffer));
+					REQUIRE(ret.first == 0);
+					REQUIRE(ret.second == sizeof(buffer));
+					REQUIRE(memcmp(buffer, randomData.data() + offset, sizeof(buffer)) == 0);
+				}
+				REQUIRE(file->close() == 0);
+			});
+
+	const auto smallData = generateData(smallFileSize, 5);
+	measure(target, "small-file create", [&smallData](distortos::FileSystem& fileSystem)
+			{
+				for (size_t i {}; i < smallFiles; ++i)
+					write(fileSystem, ("s" + std::to_string(i) + ".txt").data(), smallData, smallFileSize);
+			});
+	measure(target, "small-file delete", [](distortos::FileSystem& fileSystem)
+			{
+				for (size_t i {}; i < smallFiles; ++i)
+					REQUIRE(fileSystem.remove(("s" + std::to_string(i) + ".txt").data()) == 0);
+			});
+
+	// files are appended in round-robin, so their blocks are interleaved; then every second file is removed and a new
+	// file is written into the holes left by the removed files
+	{
+		std::vector<std::unique_ptr<distortos::File>> files;
+		for (size_t i {}; i < fragmentedFiles; ++i)
+			files.emplace_back(openFile(target.getFileSystem(), ("f" + std::to_string(i) + ".bin").data(),
+					O_WRONLY | O_CREAT | O_TRUNC));
+		const auto chunk = generateData(fragmentedChunkSize, 6);
+		for (size_t i {}; i < fragmentedChunks; ++i)
+			for (auto& file : files)
+			{
+				const auto ret = file->write(chunk.data(), chunk.size());
+				REQUIRE(ret.first == 0);
+				REQUIRE(ret.second == chunk.size());
+			}
+		for (auto& file : files)
+			REQUIRE(file->close() == 0);
+		for (size_t i {}; i < fragmentedFiles; i += 2)
+			REQUIRE(target.getFileSystem().remove(("f" + std::to_string(i) + ".bin").data()) == 0);
+	}
+	const auto fragmentedData = generateData(fragmentedFiles / 2 * fragmentedChunks * fragmentedChunkSize, 7);
+	measure(target, "fragmented write", [&fragmentedData](distortos::FileSystem& fileSystem)
+			{
+				write(fileSystem, "frag.bin", fragmentedData, sequentialChunkSize);
+			});
+	measure(target, "fragmented read", [&fragmentedData](distortos::FileSystem& fileSystem)
+			{
+				readAndVerify(fileSystem, "frag.bin", fragmentedData, sequentialChunkSize);
+			});
+
+	REQUIRE(target.getFileSystem().unmount() == 0);
+	measure(target, "mount (populated)", [](distortos::FileSystem& fileSystem)
+			{
+				REQUIRE(fileSystem.mount() == 0);
+			});
+	readAndVerify(target.getFileSystem(), "seq.bin", sequentialData, sequentialChunkSize);
+	readAndVerify(target.getFileSystem(), "rnd.bin", randomData, sequentialChunkSize);
+	REQUIRE(target.getFileSystem().unmount() == 0);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Benchmarking file systems", "[benchmark]")
+{
+	distortos::mock::Mutex mutexMock {distortos::mock::Mutex::UnitTestTag{}};
+	ALLOW_CALL(mutexMock, lock()).RETURN(0);
+	ALLOW_CALL(mutexMock, unlock()).RETURN(0);
+
+	printf("%-16s %-22s %10s %12s %11s %11s %11s\n", "target", "workload", "host, ms", "device, ms", "read, kB",
+			"written, kB", "erased, kB");
+
+	FatTarget fat {"fat", false};
+	runBenchmark(fat);
+
+	FatTarget bufferedFat {"fat-buffering", true};
+	runBenchmark(bufferedFat);
+
+	LittlefsTarget<distortos::Littlefs1FileSystem> littlefs1 {"littlefs1"};
+	runBenchmark(littlefs1);
+	littlefs1.printWear();
+
+	LittlefsTarget<distortos::Littlefs2FileSystem> littlefs2 {"littlefs2"};
+	runBenchmark(littlefs2);
+	littlefs2.printWear();
+}
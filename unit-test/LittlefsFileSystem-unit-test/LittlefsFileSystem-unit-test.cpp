@@ -0,0 +1,317 @@
+/**
+ * \file
+ * \brief Littlefs1FileSystem and Littlefs2FileSystem test cases
+ *
+ * This test checks pools of opened files of StaticLittlefs1FileSystem and StaticLittlefs2FileSystem on
+ * RamMemoryTechnologyDevice - whether opening more files than the pools hold fails with EMFILE, whether closed file
+ * returns its cache and destroyed file returns its storage for reuse, whether failed open releases its slot and whether
+ * opening files uses no dynamic memory. It also checks file systems with a pool of caches only and without any buffers.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/devices/memory/RamMemoryTechnologyDevice.hpp"
+
+#include "distortos/FileSystem/File.hpp"
+#include "distortos/FileSystem/StaticLittlefs1FileSystem.hpp"
+#include "distortos/FileSystem/StaticLittlefs2FileSystem.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <malloc.h>
+
+using distortos::devices::RamMemoryTechnologyDevice;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// read and program block size of device, bytes
+constexpr size_t blockSize {16};
+
+/// erase block size of device, bytes
+constexpr size_t eraseBlockSize {4096};
+
+/// size of device, bytes
+constexpr size_t deviceSize {eraseBlockSize * 16};
+
+/// max number of concurrently opened files in tested pools
+constexpr size_t maxOpenFiles {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// types of tested littlefs-v1 file systems
+struct Littlefs1
+{
+	/// file system with pool of caches with one element, objects of opened files are allocated dynamically
+	class PooledCachesFileSystem : public distortos::Littlefs1FileSystem
+	{
+	public:
+
+		explicit PooledCachesFileSystem(distortos::devices::MemoryTechnologyDevice& memoryTechnologyDevice) :
+				Littlefs1FileSystem{{nullptr, nullptr, nullptr, fileBuffer_.data(), nullptr, 1},
+						memoryTechnologyDevice, blockSize, blockSize, {}, {}, 32}
+		{
+
+		}
+
+	private:
+
+		/// storage for pool of caches of opened files
+		std::array<uint8_t, blockSize> fileBuffer_;
+	};
+
+	/// file system without buffers
+	using DynamicFileSystem = distortos::Littlefs1FileSystem;
+
+	/// file system with automatic storage for all caches and opened files
+	using StaticFileSystem = distortos::StaticLittlefs1FileSystem<blockSize, blockSize, 32, maxOpenFiles>;
+};
+
+/// types of tested littlefs-v2 file systems
+struct Littlefs2
+{
+	/// file system with pool of caches with one element, objects of opened files are allocated dynamically
+	class PooledCachesFileSystem : public distortos::Littlefs2FileSystem
+	{
+	public:
+
+		explicit PooledCachesFileSystem(distortos::devices::MemoryTechnologyDevice& memoryTechnologyDevice) :
+				Littlefs2FileSystem{{nullptr, nullptr, nullptr, fileBuffer_.data(), nullptr, 1},
+						memoryTechnologyDevice, {}, {}, {}, {}, 1000, blockSize, 64, {}, {}, {}}
+		{
+
+		}
+
+	private:
+
+		/// storage for pool of caches of opened files
+		std::array<uint8_t, blockSize> fileBuffer_;
+	};
+
+	/// file system without buffers
+	using DynamicFileSystem = distortos::Littlefs2FileSystem;
+
+	/// file system with automatic storage for all caches and opened files
+	using StaticFileSystem = distortos::StaticLittlefs2FileSystem<blockSize, 64, maxOpenFiles>;
+};
+
+/// RAM-backed memory technology device with tested file system
+template<typename FileSystem>
+class Fixture
+{
+public:
+
+	/**
+	 * \brief Fixture's constructor
+	 *
+	 * Formats and mounts the file system.
+	 */
+
+	Fixture() :
+			storage_(deviceSize, 0xff),
+			ramMemoryTechnologyDevice_{storage_.data(), storage_.size(), blockSize, blockSize, eraseBlockSize},
+			fileSystem_{ramMemoryTechnologyDevice_}
+	{
+		REQUIRE(fileSystem_.format() == 0);
+		REQUIRE(fileSystem_.mount() == 0);
+	}
+
+	/**
+	 * \brief Fixture's destructor
+	 *
+	 * Unmounts the file system.
+	 */
+
+	~Fixture()
+	{
+		fileSystem_.unmount();
+	}
+
+	/**
+	 * \brief Opens a file.
+	 *
+	 * \param [in] name is the name of opened file
+	 * \param [in] flags are file status flags, default - O_CREAT | O_RDWR
+	 *
+	 * \return pair with return code and opened file, as returned by FileSystem::openFile()
+	 */
+
+	std::pair<int, std::unique_ptr<distortos::File>> open(const std::string& name, const int flags = O_CREAT | O_RDWR)
+	{
+		return fileSystem_.openFile(name.c_str(), flags);
+	}
+
+	Fixture(const Fixture&) = delete;
+	Fixture& operator=(const Fixture&) = delete;
+
+private:
+
+	/// contents of device
+	std::vector<uint8_t> storage_;
+
+	/// RAM-backed memory technology device
+	RamMemoryTechnologyDevice ramMemoryTechnologyDevice_;
+
+	/// tested file system
+	FileSystem fileSystem_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Writes data to file, reads it back and closes the file.
+ *
+ * \param [in] file is a reference to opened file
+ * \param [in] data is the data written to file
+ */
+
+void writeReadAndClose(distortos::File& file, const std::string& data)
+{
+	REQUIRE(file.write(data.data(), data.size()) == std::make_pair(0, data.size()));
+	REQUIRE(file.rewind() == 0);
+	std::string readData (data.size(), '\0');
+	REQUIRE(file.read(&readData[0], readData.size()) == std::make_pair(0, readData.size()));
+	REQUIRE(readData == data);
+	REQUIRE(file.close() == 0);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEMPLATE_TEST_CASE("Testing file system with pools of opened files", "[static]", Littlefs1, Littlefs2)
+{
+	distortos::mock::Mutex mutexMock {distortos::mock::Mutex::UnitTestTag{}};
+	ALLOW_CALL(mutexMock, lock()).RETURN(0);
+	ALLOW_CALL(mutexMock, unlock()).RETURN(0);
+
+	Fixture<typename TestType::StaticFileSystem> fixture;
+
+	SECTION("Opening more files than the pool holds should fail with EMFILE, destroyed file should be reusable")
+	{
+		std::array<std::pair<int, std::unique_ptr<distortos::File>>, maxOpenFiles> files;
+		for (size_t i {}; i < files.size(); ++i)
+		{
+			files[i] = fixture.open("file" + std::to_string(i));
+			REQUIRE(files[i].first == 0);
+			REQUIRE(files[i].second != nullptr);
+		}
+
+		auto extraFile = fixture.open("extra");
+		REQUIRE(extraFile.first == EMFILE);
+		REQUIRE(extraFile.second == nullptr);
+
+		// closed file still holds its storage until it is destroyed
+		writeReadAndClose(*files[0].second, "first file");
+		REQUIRE(fixture.open("extra").first == EMFILE);
+		files[0].second.reset();
+
+		extraFile = fixture.open("extra");
+		REQUIRE(extraFile.first == 0);
+		writeReadAndClose(*extraFile.second, "extra file");
+		extraFile.second.reset();
+
+		// data written before the file was destroyed is preserved
+		files[0] = fixture.open("file0", O_RDONLY);
+		REQUIRE(files[0].first == 0);
+		std::string readData (sizeof("first file") - 1, '\0');
+		REQUIRE(files[0].second->read(&readData[0], readData.size()) == std::make_pair(0, readData.size()));
+		REQUIRE(readData == "first file");
+
+		for (auto& file : files)
+			REQUIRE(file.second->close() == 0);
+	}
+	SECTION("Failed open should release its slot")
+	{
+		for (size_t i {}; i < maxOpenFiles * 2; ++i)
+		{
+			const auto file = fixture.open("missing", O_RDONLY);
+			REQUIRE(file.first == ENOENT);
+			REQUIRE(file.second == nullptr);
+		}
+
+		std::array<std::pair<int, std::unique_ptr<distortos::File>>, maxOpenFiles> files;
+		for (size_t i {}; i < files.size(); ++i)
+		{
+			files[i] = fixture.open("file" + std::to_string(i));
+			REQUIRE(files[i].first == 0);
+		}
+		for (auto& file : files)
+			writeReadAndClose(*file.second, "data");
+	}
+	SECTION("Opening files should not use dynamic memory")
+	{
+		for (size_t i {}; i < maxOpenFiles * 2; ++i)
+		{
+			const auto allocatedMemory = mallinfo2().uordblks;
+			auto file = fixture.open("file");
+			const auto allocatedMemoryAfterOpen = mallinfo2().uordblks;
+			REQUIRE(file.first == 0);
+			REQUIRE(allocatedMemoryAfterOpen == allocatedMemory);
+			REQUIRE(file.second->close() == 0);
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Testing file system with pool of caches of opened files", "[pooledCaches]", Littlefs1, Littlefs2)
+{
+	distortos::mock::Mutex mutexMock {distortos::mock::Mutex::UnitTestTag{}};
+	ALLOW_CALL(mutexMock, lock()).RETURN(0);
+	ALLOW_CALL(mutexMock, unlock()).RETURN(0);
+
+	Fixture<typename TestType::PooledCachesFileSystem> fixture;
+
+	auto file = fixture.open("file");
+	REQUIRE(file.first == 0);
+
+	// the only cache is used by opened file
+	REQUIRE(fixture.open("other").first == EMFILE);
+
+	// closed file returns its cache, even if it is not destroyed
+	writeReadAndClose(*file.second, "data");
+
+	// failed open returns its cache
+	REQUIRE(fixture.open("missing", O_RDONLY).first == ENOENT);
+
+	auto otherFile = fixture.open("other");
+	REQUIRE(otherFile.first == 0);
+	writeReadAndClose(*otherFile.second, "other data");
+}
+
+TEMPLATE_TEST_CASE("Testing file system without buffers", "[dynamic]", Littlefs1, Littlefs2)
+{
+	distortos::mock::Mutex mutexMock {distortos::mock::Mutex::UnitTestTag{}};
+	ALLOW_CALL(mutexMock, lock()).RETURN(0);
+	ALLOW_CALL(mutexMock, unlock()).RETURN(0);
+
+	Fixture<typename TestType::DynamicFileSystem> fixture;
+
+	// number of opened files is not limited
+	std::array<std::pair<int, std::unique_ptr<distortos::File>>, maxOpenFiles * 2> files;
+	for (size_t i {}; i < files.size(); ++i)
+	{
+		files[i] = fixture.open("file" + std::to_string(i));
+		REQUIRE(files[i].first == 0);
+	}
+	for (size_t i {}; i < files.size(); ++i)
+		writeReadAndClose(*files[i].second, "data of file " + std::to_string(i));
+}
@@ -16,6 +16,7 @@
 #include "distortos/internal/FileSystem/MountPoint.hpp"
 
 #include "distortos/FileSystem/FileSystem.hpp"
+#include "distortos/InterruptMaskingLock.hpp"
 
 namespace
 {
@@ -60,7 +61,7 @@ const char* const mountPointName {"mountPointName"};
 TEST_CASE("Testing MountPoint", "[MountPoint]")
 {
 	FileSystem fileSystemMock {};
-	distortos::mock::Mutex mutexMock {distortos::mock::Mutex::UnitTestTag{}};
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxyMock {};
 	trompeloeil::sequence sequence {};
 
 	auto mp = std::make_unique<distortos::internal::MountPoint>(fileSystemMock, mountPointName, strlen(mountPointName));
@@ -72,6 +73,7 @@ TEST_CASE("Testing MountPoint", "[MountPoint]")
 	{
 		INFO("Mount point should return proper name");
 		REQUIRE(strcmp(mp->getName(), mountPointName) == 0);
+		REQUIRE(mp->getNameLength() == strlen(mountPointName));
 	}
 	{
 		INFO("Mount point should allow incrementing its reference count 255 times");
@@ -80,8 +82,8 @@ TEST_CASE("Testing MountPoint", "[MountPoint]")
 		{
 			REQUIRE(mp->getReferenceCount() == i);
 
-			REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
-			REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE_CALL(interruptMaskingLockProxyMock, construct()).IN_SEQUENCE(sequence);
+			REQUIRE_CALL(interruptMaskingLockProxyMock, destruct()).IN_SEQUENCE(sequence);
 			mp->incrementReferenceCount();
 		}
 	}
@@ -92,8 +94,8 @@ TEST_CASE("Testing MountPoint", "[MountPoint]")
 		{
 			REQUIRE(mp->getReferenceCount() == i);
 
-			REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
-			REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE_CALL(interruptMaskingLockProxyMock, construct()).IN_SEQUENCE(sequence);
+			REQUIRE_CALL(interruptMaskingLockProxyMock, destruct()).IN_SEQUENCE(sequence);
 			mp->decrementReferenceCount();
 		}
 	}
@@ -102,8 +104,8 @@ TEST_CASE("Testing MountPoint", "[MountPoint]")
 
 		REQUIRE(mp->getReferenceCount() == 1);
 
-		REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
-		REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(interruptMaskingLockProxyMock, construct()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(interruptMaskingLockProxyMock, destruct()).IN_SEQUENCE(sequence);
 		REQUIRE_CALL(fileSystemMock, unmount()).IN_SEQUENCE(sequence).RETURN(0);
 		mp.release()->decrementReferenceCount();
 	}
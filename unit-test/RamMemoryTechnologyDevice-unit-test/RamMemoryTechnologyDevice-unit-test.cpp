@@ -0,0 +1,114 @@
+/**
+ * \file
+ * \brief RamMemoryTechnologyDevice test cases
+ *
+ * This test checks whether RamMemoryTechnologyDevice emulates NOR flash memory properly and whether it counts all
+ * operations.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/devices/memory/RamMemoryTechnologyDevice.hpp"
+
+#include <array>
+
+#include <cstring>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+constexpr size_t readBlockSize {4};
+constexpr size_t programBlockSize {8};
+constexpr size_t eraseBlockSize {32};
+constexpr size_t deviceSize {eraseBlockSize * 4};
+constexpr distortos::devices::RamMemoryTechnologyDevice::Timings timings {1000us, 10us, 1us};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing RamMemoryTechnologyDevice", "[RamMemoryTechnologyDevice]")
+{
+	distortos::mock::Mutex mutexMock {distortos::mock::Mutex::UnitTestTag{}};
+	ALLOW_CALL(mutexMock, lock()).RETURN(0);
+	ALLOW_CALL(mutexMock, unlock()).RETURN(0);
+
+	std::array<uint8_t, deviceSize> buffer;
+	buffer.fill(0x55);
+	std::array<uint32_t, deviceSize / eraseBlockSize> eraseCounters {};
+	distortos::devices::RamMemoryTechnologyDevice device {buffer.data(), buffer.size(), readBlockSize,
+			programBlockSize, eraseBlockSize, timings, eraseCounters.data()};
+
+	REQUIRE(device.getEraseBlockSize() == eraseBlockSize);
+	REQUIRE(device.getProgramBlockSize() == programBlockSize);
+	REQUIRE(device.getReadBlockSize() == readBlockSize);
+	REQUIRE(device.getSize() == deviceSize);
+	REQUIRE(device.open() == 0);
+
+	SECTION("Erase fills blocks with 0xff and counts erase cycles")
+	{
+		REQUIRE(device.erase(eraseBlockSize, eraseBlockSize * 2) == 0);
+		REQUIRE(device.erase(eraseBlockSize * 2, eraseBlockSize) == 0);
+
+		for (size_t i {}; i < deviceSize; ++i)
+			REQUIRE(buffer[i] == (i >= eraseBlockSize && i < eraseBlockSize * 3 ? 0xff : 0x55));
+		REQUIRE(eraseCounters == (std::array<uint32_t, deviceSize / eraseBlockSize>{0, 1, 2, 0}));
+
+		const auto statistics = device.getStatistics();
+		REQUIRE(statistics.erases == 2);
+		REQUIRE(statistics.erasedBlocks == 3);
+		REQUIRE(statistics.busyTime == 3 * timings.eraseTime);
+	}
+	SECTION("Program can only clear bits")
+	{
+		REQUIRE(device.erase(0, eraseBlockSize) == 0);
+		const uint8_t first[programBlockSize] {0x0f, 0xf0, 0x00, 0xff, 0x12, 0x34, 0x56, 0x78};
+		const uint8_t second[programBlockSize] {0xf0, 0xf0, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff};
+		REQUIRE(device.program(programBlockSize, first, sizeof(first)) == 0);
+		REQUIRE(device.program(programBlockSize, second, sizeof(second)) == 0);
+
+		uint8_t readBuffer[programBlockSize * 2];
+		REQUIRE(device.read(0, readBuffer, sizeof(readBuffer)) == 0);
+		const uint8_t expected[programBlockSize * 2]
+		{
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+				0x00, 0xf0, 0x00, 0x0f, 0x12, 0x34, 0x56, 0x78,
+		};
+		REQUIRE(memcmp(readBuffer, expected, sizeof(expected)) == 0);
+
+		const auto statistics = device.getStatistics();
+		REQUIRE(statistics.programs == 2);
+		REQUIRE(statistics.programmedBytes == sizeof(first) + sizeof(second));
+		REQUIRE(statistics.reads == 1);
+		REQUIRE(statistics.readBytes == sizeof(readBuffer));
+		REQUIRE(statistics.busyTime == timings.eraseTime + 2 * timings.programTime +
+				sizeof(readBuffer) / readBlockSize * timings.readTime);
+	}
+	SECTION("Resetting statistics does not reset erase counters")
+	{
+		REQUIRE(device.erase(0, eraseBlockSize) == 0);
+		device.resetStatistics();
+
+		const auto statistics = device.getStatistics();
+		REQUIRE(statistics.erases == 0);
+		REQUIRE(statistics.erasedBlocks == 0);
+		REQUIRE(statistics.busyTime == decltype(statistics.busyTime)::zero());
+		REQUIRE(eraseCounters[0] == 1);
+	}
+
+	REQUIRE(device.close() == 0);
+}
@@ -512,6 +512,105 @@ TEST_CASE("Testing startTransaction()", "[startTransaction]")
 		}
 	}
 
+	SECTION("Testing transactions with response and gathered write transfer")
+	{
+		constexpr uint8_t command {0x19};
+		constexpr uint32_t argument {0x2b6e0d37};
+		constexpr uint32_t expectedResponse {0x5a0c92e4};
+		constexpr uint16_t timeoutMs {456};
+		constexpr size_t blockSize {512};
+
+		uint8_t buffer0[blockSize] {};
+		uint8_t buffer1[blockSize * 2] {};
+		uint8_t buffer2[blockSize] {};
+		const distortos::devices::WriteSegment segments[]
+		{
+				{buffer0, sizeof(buffer0)},
+				{buffer1, sizeof(buffer1)},
+				{buffer2, sizeof(buffer2)},
+		};
+		constexpr size_t segmentsCount {sizeof(segments) / sizeof(*segments)};
+
+		for (size_t failedSegment {}; failedSegment <= segmentsCount; ++failedSegment)
+		{
+			const auto result = failedSegment < segmentsCount ? Result::dataCrcMismatch : Result::success;
+			DYNAMIC_SECTION("Data CRC mismatch in segment " << failedSegment << ", expected result " <<
+					static_cast<int>(result))
+			{
+				std::array<uint32_t, 1> response {};
+				const auto dmaFlags = Flags::transferCompleteInterruptDisable |
+						Flags::peripheralFlowController |
+						Flags::memoryToPeripheral |
+						Flags::peripheralFixed |
+						Flags::memoryIncrement |
+						Flags::veryHighPriority |
+						Flags::dataSize4 |
+						Flags::burstSize4;
+
+				REQUIRE_CALL(peripheralMock, getFifoAddress()).IN_SEQUENCE(sequence).RETURN(fifoAddress);
+				REQUIRE_CALL(dmaChannelMock, startTransfer(reinterpret_cast<uintptr_t>(buffer0), fifoAddress,
+						sizeof(buffer0) / 4, dmaFlags)).IN_SEQUENCE(sequence);
+				const auto dtimer = (adapterFrequency / 257 + 1000 - 1) / 1000 * timeoutMs;
+				REQUIRE_CALL(peripheralMock, writeDtimer(dtimer)).IN_SEQUENCE(sequence);
+				REQUIRE_CALL(peripheralMock, writeDlen(sizeof(buffer0))).IN_SEQUENCE(sequence);
+				auto dctrl = 9u << SDMMC_DCTRL_DBLOCKSIZE_Pos | SDMMC_DCTRL_DMAEN;
+				REQUIRE_CALL(peripheralMock, writeDctrl(dctrl)).IN_SEQUENCE(sequence);
+				REQUIRE_CALL(peripheralMock, writeArg(argument)).IN_SEQUENCE(sequence);
+				const auto cmd = SDMMC_CMD_CPSMEN | SDMMC_CMD_WAITRESP_0 | command << SDMMC_CMD_CMDINDEX_Pos;
+				REQUIRE_CALL(peripheralMock, writeCmd(cmd)).IN_SEQUENCE(sequence);
+				const auto mask0 = SDMMC_MASK_CMDRENDIE | SDMMC_MASK_CTIMEOUTIE | SDMMC_MASK_CCRCFAILIE;
+				REQUIRE_CALL(peripheralMock, writeMask(mask0)).IN_SEQUENCE(sequence);
+				sdMmc.startTransaction(cardMock, command, argument, Response{response},
+						WriteTransfer{distortos::devices::WriteSegmentsRange{segments},
+						sizeof(buffer0) + sizeof(buffer1) + sizeof(buffer2), blockSize, timeoutMs});
+
+				{
+					REQUIRE_CALL(peripheralMock, readSta()).IN_SEQUENCE(sequence).RETURN(SDMMC_STA_CMDSENT |
+							SDMMC_STA_CMDREND);
+					REQUIRE_CALL(peripheralMock, writeIcr(allIcrBits)).IN_SEQUENCE(sequence);
+					REQUIRE_CALL(peripheralMock, readDctrl()).IN_SEQUENCE(sequence).RETURN(dctrl);
+					dctrl |= SDMMC_DCTRL_DTEN;
+					REQUIRE_CALL(peripheralMock, writeDctrl(dctrl)).IN_SEQUENCE(sequence);
+					const auto mask1 = SDMMC_MASK_DATAENDIE | SDMMC_MASK_TXUNDERRIE | SDMMC_MASK_DTIMEOUTIE |
+							SDMMC_MASK_DCRCFAILIE;
+					REQUIRE_CALL(peripheralMock, writeMask(mask1)).IN_SEQUENCE(sequence);
+					sdMmc.interruptHandler();
+				}
+
+				for (size_t i {}; i < segmentsCount; ++i)
+				{
+					const auto sta = i == failedSegment ? SDMMC_STA_DATAEND | SDMMC_STA_DCRCFAIL :
+							SDMMC_STA_DBCKEND | SDMMC_STA_DATAEND;
+					REQUIRE_CALL(peripheralMock, readSta()).IN_SEQUENCE(sequence).RETURN(sta);
+					REQUIRE_CALL(peripheralMock, writeIcr(allIcrBits)).IN_SEQUENCE(sequence);
+					REQUIRE_CALL(peripheralMock, readDctrl()).IN_SEQUENCE(sequence).RETURN(dctrl);
+					REQUIRE_CALL(peripheralMock, writeDctrl(0u)).IN_SEQUENCE(sequence);
+					REQUIRE_CALL(dmaChannelMock, stopTransfer()).IN_SEQUENCE(sequence);
+
+					if (i != failedSegment && i + 1 < segmentsCount)
+					{
+						const auto& segment = segments[i + 1];
+						REQUIRE_CALL(peripheralMock, getFifoAddress()).IN_SEQUENCE(sequence).RETURN(fifoAddress);
+						REQUIRE_CALL(dmaChannelMock, startTransfer(reinterpret_cast<uintptr_t>(segment.buffer),
+								fifoAddress, segment.size / 4, dmaFlags)).IN_SEQUENCE(sequence);
+						REQUIRE_CALL(peripheralMock, writeDlen(segment.size)).IN_SEQUENCE(sequence);
+						REQUIRE_CALL(peripheralMock, writeDctrl(dctrl)).IN_SEQUENCE(sequence);
+						sdMmc.interruptHandler();
+						continue;
+					}
+
+					REQUIRE_CALL(peripheralMock, writeMask(0u)).IN_SEQUENCE(sequence);
+					REQUIRE_CALL(peripheralMock, readResp1()).IN_SEQUENCE(sequence).RETURN(expectedResponse);
+					REQUIRE_CALL(cardMock, transactionCompleteEvent(result)).IN_SEQUENCE(sequence);
+					sdMmc.interruptHandler();
+					break;
+				}
+
+				REQUIRE(response[0] == expectedResponse);
+			}
+		}
+	}
+
 	{
 		REQUIRE_CALL(dmaChannelMock, release()).IN_SEQUENCE(sequence);
 		REQUIRE_CALL(peripheralMock, writeMask(0u)).IN_SEQUENCE(sequence);
@@ -282,3 +282,85 @@ TEST_CASE("Testing startTransfer()", "[startTransfer]")
 		spi.stop();
 	}
 }
+
+TEST_CASE("Testing startTransfer() of transfers executed by polling", "[startTransfer]")
+{
+	SpiMaster masterMock {};
+	distortos::chip::SpiPeripheral peripheralMock {};
+	distortos::chip::DmaChannel rxDmaChannelMock {};
+	distortos::chip::DmaChannel txDmaChannelMock {};
+	distortos::chip::Stm32Spiv1Spiv2Mock stm32Spiv1Spiv2Mock {};
+	trompeloeil::sequence sequence {};
+
+	distortos::chip::SpiMasterLowLevelDmaBased spi {peripheralMock, rxDmaChannelMock, rxDmaRequest, txDmaChannelMock,
+			txDmaRequest};
+
+	{
+		REQUIRE_CALL(rxDmaChannelMock, reserve(rxDmaRequest, _)).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(txDmaChannelMock, reserve(txDmaRequest, _)).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE_CALL(peripheralMock, writeCr1(initialCr1)).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(peripheralMock, writeCr2(initialCr2)).IN_SEQUENCE(sequence);
+		REQUIRE(spi.start() == 0);
+	}
+
+	for (auto wordLength {distortos::chip::minSpiWordLength}; wordLength <= distortos::chip::maxSpiWordLength;
+			++wordLength)
+		DYNAMIC_SECTION("Testing " << static_cast<int>(wordLength) << "-bit transfers")
+		{
+			constexpr uint16_t dummyData {0x5b3e};
+			REQUIRE_CALL(stm32Spiv1Spiv2Mock, configureSpi(_, distortos::devices::SpiMode{}, uint32_t{}, wordLength,
+					bool{})).LR_WITH(&_1 == &peripheralMock).IN_SEQUENCE(sequence);
+			spi.configure({}, {}, wordLength, {}, dummyData);
+
+			constexpr size_t transferSize {DISTORTOS_CHIP_SPI_POLLING_THRESHOLD};
+			const uint8_t txData[transferSize] {0x93, 0x0c, 0xe1, 0x76};
+			const uint8_t rxData[transferSize] {0x2a, 0xd7, 0x48, 0xbf};
+			uint8_t readBuffer[transferSize] {};
+			const void* const txBuffers[]
+			{
+					nullptr,
+					txData,
+			};
+			void* const rxBuffers[]
+			{
+					nullptr,
+					readBuffer,
+			};
+			for (const auto txBuffer : txBuffers)
+				for (const auto rxBuffer : rxBuffers)
+					DYNAMIC_SECTION("Testing " << static_cast<int>(wordLength) << "-bit transfers, " <<
+							(txBuffer != nullptr ? "non-" : "") << "null source, " <<
+							(rxBuffer != nullptr ? "non-" : "") << "null destination")
+					{
+						const auto dataSize = (wordLength + 8 - 1) / 8u;
+						std::vector<std::unique_ptr<trompeloeil::expectation>> expectations {};
+						for (size_t i {}; i < transferSize; i += dataSize)
+						{
+							const uint16_t txWord = txBuffer == nullptr ? dummyData :
+									dataSize == 1 ? txData[i] : txData[i] | txData[i + 1] << 8;
+							const uint16_t rxWord = dataSize == 1 ? rxData[i] : rxData[i] | rxData[i + 1] << 8;
+							expectations.emplace_back(NAMED_REQUIRE_CALL(peripheralMock,
+									writeDr(wordLength, txWord)).IN_SEQUENCE(sequence));
+							expectations.emplace_back(NAMED_REQUIRE_CALL(peripheralMock,
+									readSr()).IN_SEQUENCE(sequence).RETURN(0));
+							expectations.emplace_back(NAMED_REQUIRE_CALL(peripheralMock,
+									readSr()).IN_SEQUENCE(sequence).RETURN(SPI_SR_RXNE));
+							expectations.emplace_back(NAMED_REQUIRE_CALL(peripheralMock,
+									readDr(wordLength)).IN_SEQUENCE(sequence).RETURN(rxWord));
+						}
+						REQUIRE_CALL(masterMock, transferCompleteEvent(true)).IN_SEQUENCE(sequence);
+						spi.startTransfer(masterMock, txBuffer, rxBuffer, transferSize);
+
+						if (rxBuffer != nullptr)
+							REQUIRE(memcmp(rxBuffer, rxData, transferSize) == 0);
+					}
+		}
+
+	{
+		REQUIRE_CALL(rxDmaChannelMock, release()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(txDmaChannelMock, release()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(peripheralMock, writeCr1(0u)).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(peripheralMock, writeCr2(0u)).IN_SEQUENCE(sequence);
+		spi.stop();
+	}
+}
@@ -682,6 +682,43 @@ TEST_CASE("Testing get*BlockSize()", "[get*BlockSize]")
 
 					REQUIRE(sdCard.write(address, buffer, sizeof(buffer)) == 0);
 				}
+				SECTION("Testing writeGather() of 5 blocks in 2 segments")
+				{
+					const uint8_t buffer0[blockSize * 2] {};
+					const uint8_t buffer1[blockSize * 3] {};
+					const distortos::devices::WriteSegment segments[]
+					{
+							{buffer0, sizeof(buffer0)},
+							{buffer1, sizeof(buffer1)},
+					};
+					constexpr size_t size {sizeof(buffer0) + sizeof(buffer1)};
+					constexpr uint16_t block {0x5b3c};
+					constexpr uint64_t address {block * blockSize};
+
+					REQUIRE_CALL(mutexMock, lock()).IN_SEQUENCE(sequence).RETURN(0);
+					REQUIRE_CALL(synchronousSdCardLowLevelMock,
+							executeTransaction(13u, shiftedRca, responseMatcher(1), transferMatcher()))
+							.IN_SEQUENCE(sequence).SIDE_EFFECT(copy(cmd13Response, _3)).RETURN(Result::success);
+					REQUIRE_CALL(synchronousSdCardLowLevelMock,
+							executeTransaction(55u, shiftedRca, responseMatcher(1), transferMatcher()))
+							.IN_SEQUENCE(sequence).SIDE_EFFECT(copy(cmd55Response, _3)).RETURN(Result::success);
+					REQUIRE_CALL(synchronousSdCardLowLevelMock,
+							executeTransaction(23u, size / blockSize, responseMatcher(1), transferMatcher()))
+							.IN_SEQUENCE(sequence).SIDE_EFFECT(copy(acmd23Response, _3)).RETURN(Result::success);
+					REQUIRE_CALL(synchronousSdCardLowLevelMock,
+							executeTransaction(25u, blockAddressing == false ? address : block, responseMatcher(1),
+							transferMatcher(true, size, blockSize, writeTimeoutMs)))
+							.LR_WITH(_4.getWriteSegments().begin() == segments && _4.getWriteSegments().size() == 2)
+							.IN_SEQUENCE(sequence).SIDE_EFFECT(copy(cmd25Response, _3)).RETURN(Result::success);
+					REQUIRE_CALL(synchronousSdCardLowLevelMock,
+							executeTransaction(12u, 0u, responseMatcher(1), transferMatcher())).IN_SEQUENCE(sequence)
+							.SIDE_EFFECT(copy(cmd12AfterCmd25Response, _3)).RETURN(Result::success);
+					REQUIRE_CALL(tickClockMock, nowMock()).IN_SEQUENCE(sequence)
+							.RETURN(distortos::TickClock::time_point{});
+					REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(sequence).RETURN(0);
+
+					REQUIRE(sdCard.writeGather(address, distortos::devices::WriteSegmentsRange{segments}) == 0);
+				}
 				SECTION("Testing write() failure: CMD13 response timeout")
 				{
 					const uint8_t buffer[blockSize] {};
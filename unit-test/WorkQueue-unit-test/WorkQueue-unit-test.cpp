@@ -0,0 +1,156 @@
+/**
+ * \file
+ * \brief WorkQueue test cases
+ *
+ * This test checks whether WorkQueue executes work items properly, in correct order and coalesces repeated requests.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/WorkQueue.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <vector>
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// context shared by all work items of the test
+struct Context
+{
+	/// pointers to executed work items, in order of execution
+	std::vector<const distortos::WorkItem*> executed;
+
+	/// pointer to tested work queue
+	distortos::WorkQueue* workQueue;
+
+	/// number of times the work item will submit itself again
+	int resubmissions;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function of work items which appends work item to vector of executed work items.
+ *
+ * \param [in] workItem is a reference to executed work item
+ */
+
+void function(distortos::WorkItem& workItem)
+{
+	REQUIRE(workItem.isPending() == false);
+	static_cast<Context*>(workItem.getContext())->executed.emplace_back(&workItem);
+}
+
+/**
+ * \brief Function of work item which submits itself again, as long as requested number of resubmissions is not reached.
+ *
+ * \param [in] workItem is a reference to executed work item
+ */
+
+void resubmittingFunction(distortos::WorkItem& workItem)
+{
+	function(workItem);
+
+	auto& context = *static_cast<Context*>(workItem.getContext());
+	if (context.resubmissions == 0)
+		return;
+
+	--context.resubmissions;
+	REQUIRE(context.workQueue->submit(workItem) == 0);
+	REQUIRE(workItem.isPending() == true);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing submit(), cancel() and run()", "[submit][cancel][run]")
+{
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxyMock {};
+	distortos::mock::Semaphore semaphoreMock;
+	trompeloeil::sequence sequence {};
+
+	ALLOW_CALL(interruptMaskingLockProxyMock, construct());
+	ALLOW_CALL(interruptMaskingLockProxyMock, destruct());
+
+	distortos::WorkQueue workQueue;
+	Context context {{}, &workQueue, {}};
+
+	SECTION("Failed submission should leave the work item not pending")
+	{
+		distortos::WorkItem workItem {function, &context};
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(EOVERFLOW);
+		REQUIRE(workQueue.submit(workItem) == EOVERFLOW);
+		REQUIRE(workItem.isPending() == false);
+	}
+	SECTION("Work items should be executed in order of priority, repeated requests should be coalesced")
+	{
+		distortos::WorkItem workItems[]
+		{
+				distortos::WorkItem{function, &context, 1},
+				distortos::WorkItem{function, &context, 3},
+				distortos::WorkItem{function, &context, 1},
+				distortos::WorkItem{function, &context, 3},
+				distortos::WorkItem{function, &context, 2},
+		};
+		REQUIRE(workItems[4].getPriority() == 2);
+
+		for (auto& workItem : workItems)
+		{
+			REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+			REQUIRE(workQueue.submit(workItem) == 0);
+			REQUIRE(workItem.isPending() == true);
+		}
+
+		// work items which are already pending are not submitted again
+		REQUIRE(workQueue.submit(workItems[0]) == 0);
+		REQUIRE(workQueue.submit(workItems[3]) == 0);
+
+		REQUIRE(workQueue.cancel(workItems[2]) == true);
+		REQUIRE(workItems[2].isPending() == false);
+		REQUIRE(workQueue.cancel(workItems[2]) == false);
+
+		REQUIRE_CALL(semaphoreMock, post()).IN_SEQUENCE(sequence).RETURN(0);
+		REQUIRE(workQueue.stop() == 0);
+
+		// 4 executed work items + 1 for the cancelled one, after which the stop request is noticed
+		REQUIRE_CALL(semaphoreMock, wait()).TIMES(5).RETURN(0);
+		workQueue.run();
+
+		REQUIRE(context.executed == (std::vector<const distortos::WorkItem*>{&workItems[1], &workItems[3],
+				&workItems[4], &workItems[0]}));
+		for (const auto& workItem : workItems)
+			REQUIRE(workItem.isPending() == false);
+	}
+	SECTION("Work item submitted by its own function should be executed again")
+	{
+		distortos::WorkItem workItem {resubmittingFunction, &context};
+		context.resubmissions = 2;
+
+		REQUIRE_CALL(semaphoreMock, post()).TIMES(4).RETURN(0);
+		REQUIRE(workQueue.submit(workItem) == 0);
+		REQUIRE(workQueue.stop() == 0);
+
+		REQUIRE_CALL(semaphoreMock, wait()).TIMES(4).RETURN(0);
+		workQueue.run();
+
+		REQUIRE(context.executed == (std::vector<const distortos::WorkItem*>{&workItem, &workItem, &workItem}));
+		REQUIRE(context.resubmissions == 0);
+	}
+}
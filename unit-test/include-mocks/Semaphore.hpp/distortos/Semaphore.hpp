@@ -96,6 +96,11 @@ public:
 		return mock::Semaphore::getInstance().post();
 	}
 
+	int tryWait()
+	{
+		return mock::Semaphore::getInstance().tryWait();
+	}
+
 	int wait()
 	{
 		return mock::Semaphore::getInstance().wait();
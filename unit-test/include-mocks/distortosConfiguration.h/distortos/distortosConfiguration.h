@@ -14,6 +14,7 @@
 
 #define DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT 8
 #define DISTORTOS_BLOCKDEVICE_BUFFER_ALIGNMENT 16
+#define DISTORTOS_CHIP_SPI_POLLING_THRESHOLD 4
 #define DISTORTOS_FILESYSTEMS_STANDARD_LIBRARY_INTEGRATION_ENABLE 1
 #define DISTORTOS_ROUND_ROBIN_FREQUENCY 10
 #define DISTORTOS_SDMMCCARD_BUFFER_ALIGNMENT 16
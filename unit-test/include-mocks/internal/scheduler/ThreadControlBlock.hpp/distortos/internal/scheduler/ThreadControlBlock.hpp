@@ -32,6 +32,8 @@ class ThreadControlBlock : public ThreadListNode
 public:
 
 	MAKE_MOCK0(getOwnedProtocolMutexList, MutexList&());
+	MAKE_MOCK1(lowerBoostedPriority, void(uint8_t));
+	MAKE_MOCK1(raiseBoostedPriority, void(uint8_t));
 	MAKE_MOCK1(setPriorityInheritanceMutexControlBlock, void(const MutexControlBlock*));
 	MAKE_MOCK0(updateBoostedPriority, void());
 	MAKE_MOCK1(updateBoostedPriority, void(uint8_t));
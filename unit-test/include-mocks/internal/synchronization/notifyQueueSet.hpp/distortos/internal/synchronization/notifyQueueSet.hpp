@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief Mock of notifyQueueSet()
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SYNCHRONIZATION_NOTIFYQUEUESET_HPP_DISTORTOS_INTERNAL_SYNCHRONIZATION_NOTIFYQUEUESET_HPP_
+#define UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SYNCHRONIZATION_NOTIFYQUEUESET_HPP_DISTORTOS_INTERNAL_SYNCHRONIZATION_NOTIFYQUEUESET_HPP_
+
+#include "unit-test-common.hpp"
+
+namespace distortos
+{
+
+class QueueSet;
+
+namespace internal
+{
+
+/// semaphores in unit tests are never members of QueueSet, so the set is never notified
+inline static void notifyQueueSet(QueueSet&)
+{
+	FAIL("notifyQueueSet() called");
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SYNCHRONIZATION_NOTIFYQUEUESET_HPP_DISTORTOS_INTERNAL_SYNCHRONIZATION_NOTIFYQUEUESET_HPP_
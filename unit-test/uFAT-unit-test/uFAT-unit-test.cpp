@@ -0,0 +1,549 @@
+/**
+ * \file
+ * \brief uFAT test cases
+ *
+ * This test checks whether ufat_file_fill() (and ufat_alloc_run() used by it) allocate clusters for a gap as a single
+ * contiguous run, whether randomized sequences of writes and fills on a fragmented volume produce correct contents of
+ * file without leaking clusters and whether running out of space leaves the volume unchanged. It also checks whether
+ * ufat_file_read() and ufat_file_write() transfer each run of contiguous clusters with a single operation of the
+ * device.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "ufat.h"
+
+extern "C"
+{
+
+#include "ufat_internal.h"
+
+}	// extern "C"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstring>
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// base-2 logarithm of size of block, bytes
+constexpr unsigned int log2BlockSize {9};
+
+/// size of block, bytes
+constexpr size_t blockSize {1 << log2BlockSize};
+
+/// number of blocks in tested volume - 4 MiB
+constexpr size_t blocks {8192};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single transfer of blocks
+struct Transfer
+{
+	/// index of first block
+	ufat_block_t start;
+
+	/// number of blocks
+	ufat_block_t count;
+};
+
+/// RAM-backed block device for uFAT
+struct RamDevice
+{
+	/// uFAT's block device, must be the first member
+	ufat_device device;
+
+	/// contents of device
+	std::vector<uint8_t> data;
+
+	/// log of read transfers
+	std::vector<Transfer> reads;
+
+	/// log of write transfers
+	std::vector<Transfer> writes;
+};
+
+/// fixture with formatted and opened volume
+class Volume
+{
+public:
+
+	/**
+	 * \brief Volume's constructor
+	 *
+	 * Formats RAM device, opens the file system and its root directory.
+	 */
+
+	Volume() :
+			ramDevice_{{log2BlockSize, read, write}, std::vector<uint8_t>(blocks * blockSize), {}, {}},
+			root_{},
+			ufat_{}
+	{
+		REQUIRE(ufat_mkfs(&ramDevice_.device, blocks) == 0);
+		REQUIRE(ufat_open(&ufat_, &ramDevice_.device) == 0);
+		ufat_open_root(&ufat_, &root_);
+	}
+
+	/**
+	 * \brief Volume's destructor
+	 */
+
+	~Volume()
+	{
+		ufat_close(&ufat_);
+	}
+
+	/**
+	 * \brief Creates a file and opens it.
+	 *
+	 * \param [in] name is the name of created file
+	 * \param [out] dirent is a reference to directory entry of created file
+	 * \param [out] file is a reference to opened file
+	 */
+
+	void createFile(const std::string& name, ufat_dirent& dirent, ufat_file& file)
+	{
+		REQUIRE(ufat_dir_mkfile(&root_, &dirent, name.c_str()) == 0);
+		REQUIRE(ufat_open_file(&ufat_, &file, &dirent) == 0);
+	}
+
+	/**
+	 * \brief Deletes a file.
+	 *
+	 * \param [in] name is the name of deleted file
+	 */
+
+	void deleteFile(const std::string& name)
+	{
+		ufat_dirent dirent {};
+		ufat_dir_rewind(&root_);
+		REQUIRE(ufat_dir_find(&root_, name.c_str(), &dirent) == 0);
+		REQUIRE(ufat_dir_delete(&ufat_, &dirent) == 0);
+	}
+
+	/**
+	 * \return number of free clusters
+	 */
+
+	ufat_cluster_t getFreeClusters()
+	{
+		ufat_cluster_t freeClusters {};
+		REQUIRE(ufat_count_free_clusters(&ufat_, &freeClusters) == 0);
+		return freeClusters;
+	}
+
+	/**
+	 * \return size of cluster, bytes
+	 */
+
+	size_t getClusterSize() const
+	{
+		return blockSize << ufat_.bpb.log2_blocks_per_cluster;
+	}
+
+	/**
+	 * \brief Clears logs of read and write transfers.
+	 */
+
+	void clearTransfers()
+	{
+		ramDevice_.reads.clear();
+		ramDevice_.writes.clear();
+	}
+
+	/**
+	 * \return read transfers in data area of the volume
+	 */
+
+	std::vector<Transfer> getDataReads() const
+	{
+		return getDataTransfers(ramDevice_.reads);
+	}
+
+	/**
+	 * \return write transfers in data area of the volume
+	 */
+
+	std::vector<Transfer> getDataWrites() const
+	{
+		return getDataTransfers(ramDevice_.writes);
+	}
+
+	/**
+	 * \return reference to opened file system
+	 */
+
+	ufat& getUfat()
+	{
+		return ufat_;
+	}
+
+	/**
+	 * \brief Writes all cached blocks to the device.
+	 */
+
+	void sync()
+	{
+		REQUIRE(ufat_sync(&ufat_) == 0);
+	}
+
+private:
+
+	/**
+	 * \brief Filters transfers in data area of the volume.
+	 *
+	 * \param [in] transfers is a log of transfers
+	 *
+	 * \return transfers from \a transfers which start in data area of the volume
+	 */
+
+	std::vector<Transfer> getDataTransfers(const std::vector<Transfer>& transfers) const
+	{
+		std::vector<Transfer> dataTransfers;
+		for (const auto& transfer : transfers)
+			if (transfer.start >= ufat_.bpb.cluster_start)
+				dataTransfers.emplace_back(transfer);
+		return dataTransfers;
+	}
+
+	/**
+	 * \brief Reads blocks from RAM device.
+	 *
+	 * \param [in] device is a pointer to RAM device
+	 * \param [in] start is the index of first block
+	 * \param [in] count is the number of blocks
+	 * \param [out] buffer is a pointer to buffer for read data
+	 *
+	 * \return 0 on success, -1 if blocks are out of range
+	 */
+
+	static int read(const ufat_device* const device, const ufat_block_t start, const ufat_block_t count,
+			void* const buffer)
+	{
+		auto& ramDevice = *const_cast<RamDevice*>(reinterpret_cast<const RamDevice*>(device));
+		if ((start + count) * blockSize > ramDevice.data.size())
+			return -1;
+
+		ramDevice.reads.push_back({start, count});
+		memcpy(buffer, ramDevice.data.data() + start * blockSize, count * blockSize);
+		return 0;
+	}
+
+	/**
+	 * \brief Writes blocks to RAM device.
+	 *
+	 * \param [in] device is a pointer to RAM device
+	 * \param [in] start is the index of first block
+	 * \param [in] count is the number of blocks
+	 * \param [in] buffer is a pointer to buffer with written data
+	 *
+	 * \return 0 on success, -1 if blocks are out of range
+	 */
+
+	static int write(const ufat_device* const device, const ufat_block_t start, const ufat_block_t count,
+			const void* const buffer)
+	{
+		auto& ramDevice = *const_cast<RamDevice*>(reinterpret_cast<const RamDevice*>(device));
+		if ((start + count) * blockSize > ramDevice.data.size())
+			return -1;
+
+		ramDevice.writes.push_back({start, count});
+		memcpy(ramDevice.data.data() + start * blockSize, buffer, count * blockSize);
+		return 0;
+	}
+
+	/// RAM device with the volume
+	RamDevice ramDevice_;
+
+	/// root directory
+	ufat_directory root_;
+
+	/// opened file system
+	ufat ufat_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Transfer's equality comparison operator
+ *
+ * \param [in] left is a reference to left-hand side of equality operator
+ * \param [in] right is a reference to right-hand side of equality operator
+ *
+ * \return true if \a left and \a right are equal, false otherwise
+ */
+
+bool operator==(const Transfer& left, const Transfer& right)
+{
+	return left.start == right.start && left.count == right.count;
+}
+
+/**
+ * \brief Reads whole contents of file.
+ *
+ * \param [in] file is a reference to opened file
+ *
+ * \return contents of file
+ */
+
+std::vector<uint8_t> readFile(ufat_file& file)
+{
+	std::vector<uint8_t> contents(file.file_size);
+	ufat_file_rewind(&file);
+	REQUIRE(ufat_file_read(&file, contents.data(), contents.size()) == static_cast<int>(contents.size()));
+	return contents;
+}
+
+/**
+ * \brief Counts fragments of chain of clusters.
+ *
+ * \param [in] volume is a reference to volume
+ * \param [in] start is the first cluster of chain
+ *
+ * \return number of runs of contiguous clusters in the chain
+ */
+
+size_t countFragments(Volume& volume, ufat_cluster_t start)
+{
+	size_t fragments {};
+	while (UFAT_CLUSTER_IS_PTR(start))
+	{
+		ufat_cluster_t next {};
+		REQUIRE(ufat_read_fat(&volume.getUfat(), start, &next) == 0);
+		if (next != start + 1)
+			++fragments;
+		start = next;
+	}
+	return fragments;
+}
+
+/**
+ * \brief Gets runs of contiguous blocks of chain of clusters.
+ *
+ * \param [in] volume is a reference to volume
+ * \param [in] start is the first cluster of chain
+ *
+ * \return runs of contiguous blocks of the chain, in the same order as in the chain
+ */
+
+std::vector<Transfer> getRuns(Volume& volume, ufat_cluster_t start)
+{
+	const auto& bpb = volume.getUfat().bpb;
+	const ufat_block_t blocksPerCluster = 1 << bpb.log2_blocks_per_cluster;
+	std::vector<Transfer> runs;
+	while (UFAT_CLUSTER_IS_PTR(start))
+	{
+		const auto block = cluster_to_block(&bpb, start);
+		if (runs.empty() == false && runs.back().start + runs.back().count == block)
+			runs.back().count += blocksPerCluster;
+		else
+			runs.push_back({block, blocksPerCluster});
+		REQUIRE(ufat_read_fat(&volume.getUfat(), start, &start) == 0);
+	}
+	return runs;
+}
+
+/**
+ * \brief Fragments the volume.
+ *
+ * Creates files with one cluster each and deletes every other one.
+ *
+ * \param [in] volume is a reference to volume
+ * \param [in] fillerFiles is the number of created files
+ */
+
+void fragment(Volume& volume, const size_t fillerFiles)
+{
+	const std::vector<uint8_t> fillerData (volume.getClusterSize(), 0xff);
+	for (size_t i {}; i < fillerFiles; ++i)
+	{
+		ufat_dirent dirent {};
+		ufat_file file {};
+		volume.createFile("filler" + std::to_string(i), dirent, file);
+		REQUIRE(ufat_file_write(&file, fillerData.data(), fillerData.size()) == static_cast<int>(fillerData.size()));
+	}
+	for (size_t i {}; i < fillerFiles; i += 2)
+		volume.deleteFile("filler" + std::to_string(i));
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing ufat_file_fill()", "[fill]")
+{
+	Volume volume;
+	const auto initialFreeClusters = volume.getFreeClusters();
+
+	SECTION("Gap in empty volume should be allocated as a single run of contiguous clusters")
+	{
+		constexpr size_t gapSize {1024 * 1024};
+		const std::vector<uint8_t> head (100, 0x5a);
+		const std::vector<uint8_t> tail (100, 0xa5);
+
+		ufat_dirent dirent {};
+		ufat_file file {};
+		volume.createFile("gap", dirent, file);
+		REQUIRE(ufat_file_write(&file, head.data(), head.size()) == static_cast<int>(head.size()));
+		REQUIRE(ufat_file_fill(&file, gapSize) == static_cast<int>(gapSize));
+		REQUIRE(ufat_file_write(&file, tail.data(), tail.size()) == static_cast<int>(tail.size()));
+		REQUIRE(file.file_size == head.size() + gapSize + tail.size());
+
+		REQUIRE(countFragments(volume, file.start) == 1);
+		const auto clusterSize = volume.getClusterSize();
+		REQUIRE(initialFreeClusters - volume.getFreeClusters() == (file.file_size + clusterSize - 1) / clusterSize);
+
+		std::vector<uint8_t> expected {head};
+		expected.resize(head.size() + gapSize);
+		expected.insert(expected.end(), tail.begin(), tail.end());
+		REQUIRE(readFile(file) == expected);
+
+		volume.deleteFile("gap");
+		REQUIRE(volume.getFreeClusters() == initialFreeClusters);
+	}
+	SECTION("Randomized writes and fills on fragmented volume should give correct contents without leaking clusters")
+	{
+		constexpr size_t fillerFiles {64};
+
+		fragment(volume, fillerFiles);
+
+		std::mt19937 randomNumberGenerator {1};
+		std::uniform_int_distribution<size_t> lengthDistribution {1, volume.getClusterSize() * 3};
+		std::uniform_int_distribution<int> byteDistribution {1, 255};
+
+		ufat_dirent dirent {};
+		ufat_file file {};
+		volume.createFile("random", dirent, file);
+		std::vector<uint8_t> expected;
+
+		for (size_t operation {}; operation < 200; ++operation)
+		{
+			// position anywhere in the file, including its end
+			const auto position = std::uniform_int_distribution<size_t>{0, expected.size()}(randomNumberGenerator);
+			ufat_file_rewind(&file);
+			REQUIRE(ufat_file_advance(&file, position) == 0);
+
+			const auto length = lengthDistribution(randomNumberGenerator);
+			if (expected.size() < position + length)
+				expected.resize(position + length);
+
+			if (randomNumberGenerator() % 2 == 0)
+			{
+				std::vector<uint8_t> data (length);
+				for (auto& byte : data)
+					byte = byteDistribution(randomNumberGenerator);
+				REQUIRE(ufat_file_write(&file, data.data(), data.size()) == static_cast<int>(data.size()));
+				std::copy(data.begin(), data.end(), expected.begin() + position);
+			}
+			else
+			{
+				REQUIRE(ufat_file_fill(&file, length) == static_cast<int>(length));
+				std::fill_n(expected.begin() + position, length, 0);
+			}
+
+			REQUIRE(file.file_size == expected.size());
+		}
+
+		REQUIRE(readFile(file) == expected);
+
+		volume.deleteFile("random");
+		for (size_t i {1}; i < fillerFiles; i += 2)
+			volume.deleteFile("filler" + std::to_string(i));
+		REQUIRE(volume.getFreeClusters() == initialFreeClusters);
+	}
+	SECTION("Failed fill due to lack of space should leave the volume unchanged")
+	{
+		const std::vector<uint8_t> data (100, 0x5a);
+
+		ufat_dirent dirent {};
+		ufat_file file {};
+		volume.createFile("nospace", dirent, file);
+		REQUIRE(ufat_file_write(&file, data.data(), data.size()) == static_cast<int>(data.size()));
+		const auto freeClusters = volume.getFreeClusters();
+
+		REQUIRE(ufat_file_fill(&file, blocks * blockSize) == -UFAT_ERR_NO_CLUSTERS);
+		REQUIRE(volume.getFreeClusters() == freeClusters);
+		REQUIRE(file.file_size == data.size());
+		REQUIRE(readFile(file) == data);
+
+		volume.deleteFile("nospace");
+		REQUIRE(volume.getFreeClusters() == initialFreeClusters);
+	}
+}
+
+TEST_CASE("Testing number of transfers in ufat_file_read() and ufat_file_write()", "[read][write]")
+{
+	Volume volume;
+	const auto clusterSize = volume.getClusterSize();
+
+	std::vector<uint8_t> data (clusterSize * 8);
+	for (size_t i {}; i < data.size(); ++i)
+		data[i] = i * 7 + i / blockSize;
+
+	// all transfers are aligned to blocks, so they bypass the cache; each run of contiguous clusters must be
+	// transferred with one operation of the device, split exactly at the breaks of the chain
+	const auto checkTransfers =
+			[&volume, &data](ufat_file& file, const bool fragmented)
+			{
+				volume.clearTransfers();
+				ufat_file_rewind(&file);
+				REQUIRE(ufat_file_write(&file, data.data(), data.size()) == static_cast<int>(data.size()));
+
+				const auto runs = getRuns(volume, file.start);
+				REQUIRE((runs.size() > 1) == fragmented);
+				REQUIRE(volume.getDataWrites() == runs);
+
+				volume.sync();
+				volume.clearTransfers();
+				ufat_file_rewind(&file);
+				std::vector<uint8_t> readData (data.size());
+				REQUIRE(ufat_file_read(&file, readData.data(), readData.size()) == static_cast<int>(readData.size()));
+				REQUIRE(volume.getDataReads() == runs);
+				REQUIRE(readData == data);
+			};
+
+	SECTION("Contiguous multi-cluster file should be transferred with a single operation")
+	{
+		ufat_dirent dirent {};
+		ufat_file file {};
+		volume.createFile("contiguous", dirent, file);
+		checkTransfers(file, false);
+	}
+	SECTION("Fragmented file should be transferred with one operation per run of contiguous clusters")
+	{
+		// interleave appends to two files, so that chain of the first one consists of runs with 2 clusters each
+		ufat_dirent dirent {};
+		ufat_file file {};
+		volume.createFile("fragmented", dirent, file);
+		ufat_dirent otherDirent {};
+		ufat_file otherFile {};
+		volume.createFile("other", otherDirent, otherFile);
+		for (size_t offset {}; offset < data.size(); offset += 2 * clusterSize)
+		{
+			REQUIRE(ufat_file_write(&file, &data[offset], 2 * clusterSize) == static_cast<int>(2 * clusterSize));
+			REQUIRE(ufat_file_write(&otherFile, data.data(), clusterSize) == static_cast<int>(clusterSize));
+		}
+		REQUIRE(getRuns(volume, file.start).size() == data.size() / (2 * clusterSize));
+
+		checkTransfers(file, true);
+	}
+}